@@ -8,6 +8,7 @@
 //! \file athena.hpp
 //  \brief contains Athena++ general purpose types, structures, enums, etc.
 
+#include <cfloat>
 #include <string>
 
 #include <Kokkos_Core.hpp>
@@ -487,4 +488,63 @@ struct reduction_identity< array_sum::GlobalSum > {
 };
 }
 
+//----------------------------------------------------------------------------------------
+//! \struct ArrayMax
+// Custom Kokkos reducer computing the element-wise maximum of a fixed-length array, built
+// in the same way as array_sum above.  Used to reduce all fused refinement criteria over
+// a MeshBlock in a single pass.
+
+namespace array_max {
+template <class ScalarType, int N>
+struct array_type {
+  ScalarType the_array[N];
+  KOKKOS_INLINE_FUNCTION   // Default constructor - Initialize to -FLT_MAX
+  array_type() {
+    for (int i = 0; i < N; i++ ) { the_array[i] = -(FLT_MAX); }
+  }
+  KOKKOS_INLINE_FUNCTION   // Copy Constructor
+  array_type(const array_type & rhs) {
+    for (int i = 0; i < N; i++ ) { the_array[i] = rhs.the_array[i]; }
+  }
+};
+
+template <class ScalarType, int N>
+struct ArrayMax {
+ public:
+  using reducer = ArrayMax;
+  using value_type = array_type<ScalarType, N>;
+  using result_view_type = Kokkos::View<value_type, Kokkos::HostSpace,
+                                        Kokkos::MemoryUnmanaged>;
+
+ private:
+  value_type &value;
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  explicit ArrayMax(value_type &value_) : value(value_) {}
+  KOKKOS_INLINE_FUNCTION
+  void join(value_type &dest, const value_type &src) const {
+    for (int i = 0; i < N; i++ ) {
+      dest.the_array[i] = fmax(dest.the_array[i], src.the_array[i]);
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void join(volatile value_type &dest, const volatile value_type &src) const {
+    for (int i = 0; i < N; i++ ) {
+      dest.the_array[i] = fmax(dest.the_array[i], src.the_array[i]);
+    }
+  }
+  KOKKOS_INLINE_FUNCTION
+  void init(value_type &val) const {
+    for (int i = 0; i < N; i++ ) { val.the_array[i] = -(FLT_MAX); }
+  }
+  KOKKOS_INLINE_FUNCTION
+  value_type& reference() const { return value; }
+  KOKKOS_INLINE_FUNCTION
+  result_view_type view() const { return result_view_type(&value); }
+  KOKKOS_INLINE_FUNCTION
+  bool references_scalar() const { return true; }
+};
+} // namespace array_max
+
 #endif // ATHENA_HPP_
@@ -272,6 +272,7 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
   //----- STEP 2: buffers have all completed, so unpack 3-components of field
 
   auto &mblev = pmy_pack->pmb->mb_lev;
+  auto &unchanged = pmy_pack->pmb->mb_unchanged;
   // Outer loop over (# of MeshBlocks)*(# of buffers)*(three field components)
   Kokkos::TeamPolicy<> policy(DevExeSpace(), (3*nmb), Kokkos::AUTO);
   Kokkos::parallel_for("RecvBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
@@ -280,8 +281,10 @@ TaskStatus MeshBoundaryValuesFC::RecvAndUnpackFC(DvceFaceFld4D<Real> &b,
 
     // scalar loop over neighbors to prevent race condition in overlapping assignments
     for (int n=0; n<nnghbr; ++n) {
-      // only unpack buffers when neighbor exists
-      if (nghbr.d_view(m,n).gid >= 0) {
+      // only unpack buffers when neighbor exists.  After a regrid, ghost zones of
+      // unchanged MBs are kept, except those prolongated from coarser neighbors
+      if ((nghbr.d_view(m,n).gid >= 0) &&
+          !(unchanged.d_view(m) && (nghbr.d_view(m,n).lev >= mblev.d_view(m)))) {
         // if neighbor is at coarser level, use cindices to unpack buffer
         int il, iu, jl, ju, kl, ku, ndat;
         if (nghbr.d_view(m,n).lev < mblev.d_view(m)) {
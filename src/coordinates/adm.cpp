@@ -31,8 +31,24 @@ ADM::ADM(MeshBlockPack *ppack, ParameterInput *pin):
     u_adm("u_adm",1,1,1,1,1),
     pmy_pack(ppack) {
   is_dynamic = pin->GetOrAddBoolean("adm" , "dynamic", false);
+  store_z4c_adm = true;
+  if (pmy_pack->pz4c != nullptr) {
+    store_z4c_adm = pin->GetOrAddBoolean("z4c", "store_adm", true);
+  }
+  AllocateStorage();
+}
+
+//----------------------------------------------------------------------------------------
+// destructor
+ADM::~ADM() {}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ADM::AllocateStorage()
+//! \brief Allocates u_adm and initializes the ADM_vars aliases.  With Z4c the lapse and
+//! shift are aliases to the Z4c variables.
 
-  int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
+void ADM::AllocateStorage() {
+  int nmb = std::max((pmy_pack->nmb_thispack), (pmy_pack->pmesh->nmb_maxperrank));
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int ncells1 = indcs.nx1 + 2*(indcs.ng);
   int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
@@ -52,11 +68,45 @@ ADM::ADM(MeshBlockPack *ppack, ParameterInput *pin):
   adm.psi4.InitWithShallowSlice(u_adm, I_ADM_PSI4);
   adm.g_dd.InitWithShallowSlice(u_adm, I_ADM_GXX, I_ADM_GZZ);
   adm.vK_dd.InitWithShallowSlice(u_adm, I_ADM_KXX, I_ADM_KZZ);
+  is_allocated = true;
 }
 
 //----------------------------------------------------------------------------------------
-// destructor
-ADM::~ADM() {}
+//! \fn void ADM::ReleaseStorage()
+//! \brief Frees u_adm (only possible with Z4c) by shrinking it to a single cell.  The
+//! aliases must also be reset, since they share ownership of the memory.
+
+void ADM::ReleaseStorage() {
+  if (pmy_pack->pz4c == nullptr || !(is_allocated)) return;
+  Kokkos::realloc(u_adm, 1, nadm - 4, 1, 1, 1);
+  adm.psi4.InitWithShallowSlice(u_adm, I_ADM_PSI4);
+  adm.g_dd.InitWithShallowSlice(u_adm, I_ADM_GXX, I_ADM_GZZ);
+  adm.vK_dd.InitWithShallowSlice(u_adm, I_ADM_KXX, I_ADM_KZZ);
+  is_allocated = false;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn ADM::ADM_view ADM::GetADMView()
+//! \brief Returns accessors for the ADM variables, reading u_adm if it is allocated and
+//! computing them from the Z4c variables otherwise.  Must be called again after the
+//! arrays are reallocated (e.g. with AMR).
+
+ADM::ADM_view ADM::GetADMView() {
+  if (!(is_allocated)) {
+    return pmy_pack->pz4c->GetADMView();
+  }
+  ADM_view view;
+  view.alpha = adm.alpha;
+  view.beta_u = adm.beta_u;
+  view.psi4.stored = true;
+  view.psi4.psi4 = adm.psi4;
+  view.psi4.power = 1.0;
+  view.g_dd.psi4 = view.psi4;
+  view.g_dd.g_dd = adm.g_dd;
+  view.vK_dd.g_dd = view.g_dd;
+  view.vK_dd.vK_dd = adm.vK_dd;
+  return view;
+}
 
 //----------------------------------------------------------------------------------------
 void ADM::SetADMVariablesToKerrSchild(MeshBlockPack *pmbp) {
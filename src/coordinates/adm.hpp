@@ -54,10 +54,79 @@ class ADM {
     AthenaHostTensor<Real, TensorSymm::SYM2, 3, 2> vK_dd;
   };
 
+  // Accessors for psi4, g_dd and K_dd which read u_adm when it is allocated, and
+  // otherwise compute the values pointwise from the Z4c variables.  Each member is called
+  // with the same indices as the corresponding AthenaTensor in ADM_vars, and can also be
+  // passed to the finite difference operators in utils/finite_diff.hpp.
+  struct ADM_view {
+    struct Psi4 {
+      bool stored;                                        // read from u_adm
+      AthenaTensor<Real, TensorSymm::NONE, 3, 0> psi4;    // psi4 or Z4c chi
+      Real power;                                         // psi^4 = chi^power
+      KOKKOS_INLINE_FUNCTION
+      Real operator()(int const m, int const k, int const j, int const i) const {
+        if (stored) return psi4(m,k,j,i);
+        return (power == -1.0) ? 1.0/psi4(m,k,j,i) : pow(psi4(m,k,j,i), power);
+      }
+    };
+    struct Metric {
+      Psi4 psi4;
+      AthenaTensor<Real, TensorSymm::SYM2, 3, 2> g_dd;    // g_dd or Z4c conf. metric
+      KOKKOS_INLINE_FUNCTION
+      Real operator()(int const m, int const a, int const b,
+                      int const k, int const j, int const i) const {
+        if (psi4.stored) return g_dd(m,a,b,k,j,i);
+        return psi4(m,k,j,i)*g_dd(m,a,b,k,j,i);
+      }
+    };
+    struct ExtrCurv {
+      Metric g_dd;
+      AthenaTensor<Real, TensorSymm::SYM2, 3, 2> vK_dd;   // K_dd or Z4c A_dd
+      AthenaTensor<Real, TensorSymm::NONE, 3, 0> vKhat;
+      AthenaTensor<Real, TensorSymm::NONE, 3, 0> vTheta;
+      KOKKOS_INLINE_FUNCTION
+      Real operator()(int const m, int const a, int const b,
+                      int const k, int const j, int const i) const {
+        if (g_dd.psi4.stored) return vK_dd(m,a,b,k,j,i);
+        return g_dd.psi4(m,k,j,i)*vK_dd(m,a,b,k,j,i) + (1./3.)*
+               (vKhat(m,k,j,i) + 2.*vTheta(m,k,j,i))*g_dd(m,a,b,k,j,i);
+      }
+    };
+    AthenaTensor<Real, TensorSymm::NONE, 3, 0> alpha;     // lapse
+    AthenaTensor<Real, TensorSymm::NONE, 3, 1> beta_u;    // shift vector
+    Psi4 psi4;
+    Metric g_dd;
+    ExtrCurv vK_dd;
+
+    // component n of u_adm (I_ADM_GXX...I_ADM_BETAZ), for use in interpolation
+    KOKKOS_INLINE_FUNCTION
+    Real operator()(int const m, int const n,
+                    int const k, int const j, int const i) const {
+      if (n < I_ADM_PSI4) {
+        int c = (n < I_ADM_KXX) ? n : n - I_ADM_KXX;
+        int a = (c < 3) ? 0 : ((c < 5) ? 1 : 2);
+        int b = c - ((a == 0) ? 0 : ((a == 1) ? 2 : 3));
+        return (n < I_ADM_KXX) ? g_dd(m,a,b,k,j,i) : vK_dd(m,a,b,k,j,i);
+      } else if (n == I_ADM_PSI4) {
+        return psi4(m,k,j,i);
+      } else if (n == I_ADM_ALPHA) {
+        return alpha(m,k,j,i);
+      }
+      return beta_u(m,n-I_ADM_BETAX,k,j,i);
+    }
+  };
+
   DvceArray5D<Real> u_adm;                                // adm variables
   bool is_dynamic;                                        // is the metric time dependent?
+  // With Z4c the ADM variables can be computed from the Z4c variables when needed (see
+  // GetADMView), so storage for u_adm can be released after initialization.
+  bool store_z4c_adm;                                     // keep u_adm with Z4c
+  bool is_allocated;                                      // u_adm currently allocated
 
   void (*SetADMVariables)(MeshBlockPack *pm);
+  void AllocateStorage();
+  void ReleaseStorage();
+  ADM_view GetADMView();
 
   static void SetADMVariablesToKerrSchild(MeshBlockPack *pm);
 
@@ -175,10 +244,12 @@ void SpacetimeUpperMetric(Real const alp,
 //! \brief computes components of (dynamically evolved) 3-metric, lapse and
 //  shift at faces in the x direction for use in Riemann solver for a single point
 //check your indices: interface i lives between cells i and i-1
+//g_dd is either an AthenaTensor or ADM::ADM_view::Metric
 
+template <typename TYPE>
 KOKKOS_INLINE_FUNCTION
 void Face1Metric(const int m, const int k, const int j, const int i,
-     const AthenaTensor<Real, TensorSymm::SYM2, 3, 2> &g_dd,
+     const TYPE &g_dd,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 1> &beta_u,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 0> &alpha,
      Real gface1_dd[NSPMETRIC], Real betaface1_u[3], Real &alphaface1) {
@@ -205,9 +276,10 @@ void Face1Metric(const int m, const int k, const int j, const int i,
 //  shift at faces in the y direction for use in Riemann solver for a single point
 //check your indices: interface j lives between cells j and j-1
 
+template <typename TYPE>
 KOKKOS_INLINE_FUNCTION
 void Face2Metric(const int m, const int k, const int j, const int i,
-     const AthenaTensor<Real, TensorSymm::SYM2, 3, 2> &g_dd,
+     const TYPE &g_dd,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 1> &beta_u,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 0> &alpha,
      Real gface2_dd[NSPMETRIC], Real betaface2_u[3], Real &alphaface2) {
@@ -234,9 +306,10 @@ void Face2Metric(const int m, const int k, const int j, const int i,
 //  shift at faces in the z direction for use in Riemann solver for a single point
 //check your indices: interface k lives between cells k and k-1
 
+template <typename TYPE>
 KOKKOS_INLINE_FUNCTION
 void Face3Metric(const int m, const int k, const int j, const int i,
-     const AthenaTensor<Real, TensorSymm::SYM2, 3, 2> &g_dd,
+     const TYPE &g_dd,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 1> &beta_u,
      const AthenaTensor<Real, TensorSymm::NONE, 3, 0> &alpha,
      Real gface3_dd[NSPMETRIC], Real betaface3_u[3], Real &alphaface3) {
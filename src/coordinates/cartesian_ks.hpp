@@ -98,6 +98,30 @@ void ComputeMetricAndInverse(Real x, Real y, Real z, bool minkowski, Real a,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void LoadMetricAndInverse
+//! \brief loads covariant and contravariant components of metric from a cache filled by
+//!  Coordinates::SetMetricCache(), which stores 2*NMETRIC symmetric components per point
+
+KOKKOS_INLINE_FUNCTION
+void LoadMetricAndInverse(const DvceArray5D<Real> &gcache,
+                          const int m, const int k, const int j, const int i,
+                          Real glower[][4], Real gupper[][4]) {
+  const int idx[4][4] = {{I00, I01, I02, I03},
+                         {I01, I11, I12, I13},
+                         {I02, I12, I22, I23},
+                         {I03, I13, I23, I33}};
+  for (int a=0; a<4; ++a) {
+    for (int b=a; b<4; ++b) {
+      glower[a][b] = gcache(m,idx[a][b],k,j,i);
+      gupper[a][b] = gcache(m,NMETRIC+idx[a][b],k,j,i);
+      glower[b][a] = glower[a][b];
+      gupper[b][a] = gupper[a][b];
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void ComputeADMDecomposition
 //! \brief computes ADM quantitiese in Cartesian Kerr-Schild coordinates
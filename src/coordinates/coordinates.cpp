@@ -20,10 +20,23 @@
 //----------------------------------------------------------------------------------------
 // constructor, initializes coordinates data
 
-Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
+Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack,
+                         const Coordinates *pold, const int *old_mbidx) :
     pmy_pack(ppack),
     excision_floor("excision_floor",1,1,1,1),
-    excision_flux("excision_flux",1,1,1,1) {
+    excision_flux("excision_flux",1,1,1,1),
+    old_mbidx_("old_mbidx",1) {
+  // When rebuilt after AMR, store map to MBs in old Coordinates that are unchanged by
+  // the regrid, so that their geometric data can be copied
+  if ((pold != nullptr) && (old_mbidx != nullptr)) {
+    int nmb = ppack->nmb_thispack;
+    Kokkos::realloc(old_mbidx_, nmb);
+    auto h_old_mbidx = Kokkos::create_mirror_view(old_mbidx_);
+    for (int m=0; m<nmb; ++m) {h_old_mbidx(m) = old_mbidx[m];}
+    Kokkos::deep_copy(old_mbidx_, h_old_mbidx);
+    pold_coord_ = pold;
+  }
+
   // Check for relativistic dynamics
   // WGC: idea for handling new EOS
   is_dynamical_relativistic = (pin->DoesBlockExist("adm") || pin->DoesBlockExist("z4c"))
@@ -91,6 +104,14 @@ Coordinates::Coordinates(ParameterInput *pin, MeshBlockPack *ppack) :
       }
     }
   }
+
+  // Optionally precompute metric at cell centers and faces for stationary GR.  Since
+  // Coordinates is rebuilt after every AMR regrid, so is the cache.
+  if (is_general_relativistic) {
+    coord_data.cache_metric = pin->GetOrAddBoolean("coord","cache_metric",false);
+    if (coord_data.cache_metric) {SetMetricCache();}
+  }
+  pold_coord_ = nullptr;
 }
 
 //----------------------------------------------------------------------------------------
@@ -107,6 +128,8 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &cache = coord_data.cache_metric;
+  auto &gcc = coord_data.gcc;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -127,7 +150,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim, const EOS_Data &e
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (cache) {
+      LoadMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -230,6 +257,8 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = coord_data.is_minkowski;
   auto &spin = coord_data.bh_spin;
+  auto &cache = coord_data.cache_metric;
+  auto &gcc = coord_data.gcc;
 
   Real gamma_prime = eos.gamma / (eos.gamma - 1.0);
 
@@ -250,7 +279,11 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (cache) {
+      LoadMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract primitives
     const Real &rho  = prim(m,IDN,k,j,i);
@@ -353,3 +386,80 @@ void Coordinates::CoordSrcTerms(const DvceArray5D<Real> &prim,
 
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn void Coordinates::SetMetricCache()
+//! \brief Allocates and fills cache of metric and inverse at cell centers and faces,
+//! including ghost zones.  Only the 2*NMETRIC independent components are stored.
+
+void Coordinates::SetMetricCache() {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int &is = indcs.is, &js = indcs.js, &ks = indcs.ks;
+  int nmb = pmy_pack->nmb_thispack;
+  int n1 = indcs.nx1 + 2*(indcs.ng);
+  int n2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int n3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  Kokkos::realloc(coord_data.gcc,  nmb, 2*NMETRIC, n3, n2, n1);
+  Kokkos::realloc(coord_data.gx1f, nmb, 2*NMETRIC, n3, n2, n1+1);
+  Kokkos::realloc(coord_data.gx2f, nmb, 2*NMETRIC, n3, n2+1, n1);
+  Kokkos::realloc(coord_data.gx3f, nmb, 2*NMETRIC, n3+1, n2, n1);
+
+  auto &size = pmy_pack->pmb->mb_size;
+  bool &flat = coord_data.is_minkowski;
+  Real &spin = coord_data.bh_spin;
+  // after AMR, unchanged MBs copy metric from old cache (if it exists)
+  bool reuse = (pold_coord_ != nullptr) && (pold_coord_->coord_data.cache_metric);
+  auto &oldmb = old_mbidx_;
+  // loop over cell centers (dir=0) and each set of faces (dir=1,2,3)
+  for (int dir=0; dir<4; ++dir) {
+    DvceArray5D<Real> gc = coord_data.gcc;
+    if (dir == 1) gc = coord_data.gx1f;
+    if (dir == 2) gc = coord_data.gx2f;
+    if (dir == 3) gc = coord_data.gx3f;
+    DvceArray5D<Real> gold = gc;
+    if (reuse) {
+      gold = pold_coord_->coord_data.gcc;
+      if (dir == 1) gold = pold_coord_->coord_data.gx1f;
+      if (dir == 2) gold = pold_coord_->coord_data.gx2f;
+      if (dir == 3) gold = pold_coord_->coord_data.gx3f;
+    }
+    par_for("metric_cache", DevExeSpace(), 0, (nmb-1), 0, (gc.extent_int(2)-1),
+            0, (gc.extent_int(3)-1), 0, (gc.extent_int(4)-1),
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      if (reuse && oldmb(m) >= 0) {
+        for (int n=0; n<2*NMETRIC; ++n) {
+          gc(m,n,k,j,i) = gold(oldmb(m),n,k,j,i);
+        }
+        return;
+      }
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1 = (dir == 1) ? LeftEdgeX(i-is, indcs.nx1, x1min, x1max) :
+                             CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2 = (dir == 2) ? LeftEdgeX(j-js, indcs.nx2, x2min, x2max) :
+                             CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3 = (dir == 3) ? LeftEdgeX(k-ks, indcs.nx3, x3min, x3max) :
+                             CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1, x2, x3, flat, spin, glower, gupper);
+      const int idx[4][4] = {{I00, I01, I02, I03},
+                             {I01, I11, I12, I13},
+                             {I02, I12, I22, I23},
+                             {I03, I13, I23, I33}};
+      for (int a=0; a<4; ++a) {
+        for (int b=a; b<4; ++b) {
+          gc(m,idx[a][b],k,j,i) = glower[a][b];
+          gc(m,NMETRIC+idx[a][b],k,j,i) = gupper[a][b];
+        }
+      }
+    });
+  }
+  return;
+}
@@ -41,6 +41,14 @@ struct CoordData {
   Real flux_excise_r;              // reduce to first-order inside this radius
   ExcisionScheme excision_scheme;  // excision method
   Real excise_lapse;               // if excision_scheme = lapse, excise under this lapse
+
+  // optional cache of metric and inverse in GR, stored as 2*NMETRIC symmetric components
+  // (lower then upper, see MetricIndex) at cell centers and faces
+  bool cache_metric = false;
+  DvceArray5D<Real> gcc;           // metric at cell centers
+  DvceArray5D<Real> gx1f;          // metric at x1-faces
+  DvceArray5D<Real> gx2f;          // metric at x2-faces
+  DvceArray5D<Real> gx3f;          // metric at x3-faces
 };
 
 //----------------------------------------------------------------------------------------
@@ -49,7 +57,8 @@ struct CoordData {
 
 class Coordinates {
  public:
-  explicit Coordinates(ParameterInput *pin, MeshBlockPack *ppack);
+  Coordinates(ParameterInput *pin, MeshBlockPack *ppack,
+              const Coordinates *pold=nullptr, const int *old_mbidx=nullptr);
   ~Coordinates() {}
 
   // flags to denote relativistic dynamics in these coordinates
@@ -70,11 +79,17 @@ class Coordinates {
   void CoordSrcTerms(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc,
                      const EOS_Data &eos, const Real dt, DvceArray5D<Real> &u0);
   void SetExcisionMasks(DvceArray4D<bool> &floor, DvceArray4D<bool> &flux);
+  void SetMetricCache();
 
   void UpdateExcisionMasks();
 
  private:
   MeshBlockPack* pmy_pack;
+  // After AMR, index of each MB in the previous Coordinates (or -1 if MB is new), used to
+  // copy excision masks and cached metric of unchanged MBs rather than recompute them.
+  // pold_coord_ is only valid during construction.
+  const Coordinates *pold_coord_ = nullptr;
+  DvceArray1D<int> old_mbidx_;
 };
 
 #endif // COORDINATES_COORDINATES_HPP_
@@ -41,12 +41,23 @@ void Coordinates::SetExcisionMasks(DvceArray4D<bool> &excision_floor,
 
   auto &flux_excise_r = coord_data.flux_excise_r;
 
+  // after AMR, unchanged MBs copy masks from old Coordinates
+  bool reuse = (pold_coord_ != nullptr);
+  auto &oldmb = old_mbidx_;
+  auto old_floor = (reuse) ? pold_coord_->excision_floor : excision_floor;
+  auto old_flux  = (reuse) ? pold_coord_->excision_flux  : excision_flux;
+
   // NOTE(@pdmullen):
   // excision_floor: - if r_ks evaluated at this CC is <= excision_radius, mask the cell.
   // excision_flux:  - if r_ks evaluated at any portion of the two cells connecting
   //                   each face of this cell is <= excision_radius, mask the cell.
   par_for("set_excision", DevExeSpace(), 0, nmb1, 0, (n3-1), 0, (n2-1), 0, (n1-1),
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
+    if (reuse && oldmb(m) >= 0) {
+      excision_floor(m,k,j,i) = old_floor(oldmb(m),k,j,i);
+      excision_flux(m,k,j,i)  = old_flux(oldmb(m),k,j,i);
+      return;
+    }
     // NOTE(@pdmullen): In some instances, calls to x? will access coordinate information
     // for which there is *no corresponding logical counterpart*, however, the
     // LeftEdgeX/CellCenterX functions can handle "out-of-range" queries.
@@ -20,9 +20,11 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "z4c/z4c.hpp"
+#include "coordinates/adm.hpp"
 #include "dyn_grmhd/dyn_grmhd.hpp"
 #include "ion-neutral/ion-neutral.hpp"
 #include "radiation/radiation.hpp"
+#include "particles/particles.hpp"
 #include "driver.hpp"
 
 #if MPI_PARALLEL_ENABLED
@@ -61,6 +63,8 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
   ndiag(1),
   nmb_updated_(0),
   npart_updated_(0),
+  nsts_updated_(0),
+  nsts_stages(0),
   lb_efficiency_(0),
   pwall_clock_(ptimer),
   wall_time(wtlim),
@@ -88,6 +92,16 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     nlim = pin->GetOrAddInteger("time", "nlim", -1);
     ndiag = pin->GetOrAddInteger("time", "ndiag", 1);
 
+    // Weights default to zero, so that only non-zero weights need be set below.  With
+    // delta[l]=0 for l>0 (all integrators except rk4 and ssprk10_4) the intermediate
+    // stage u1 is simply a copy of u0 at the start of the timestep.
+    for (int l=0; l<(NEXP_STAGES_MAX); ++l) {
+      gam0[l] = 0.0;
+      gam1[l] = 0.0;
+      beta[l] = 0.0;
+      delta[l] = 0.0;
+    }
+
     if (integrator == "rk1") {
       // RK1: first-order Runge-Kutta / the forward Euler (FE) method
       nimp_stages = 0;
@@ -158,6 +172,51 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
       delta[1] = 0.217683334308543;
       delta[2] = 1.065841341361089;
       delta[3] = 0.0;
+    } else if (integrator == "ssprk4_3") {
+      // SSPRK (4,3): Kraaijevanger (1991), Ketcheson (2008) eq 4.2
+      // Explicit four-stage, third-order SSPRK with SSP coefficient 2 (c_eff = 1/2)
+      nimp_stages = 0;
+      nexp_stages = 4;
+      cfl_limit = 2.0;
+      gam0[0] = 1.0;
+      gam1[0] = 0.0;
+      beta[0] = 0.5;
+
+      gam0[1] = 1.0;
+      gam1[1] = 0.0;
+      beta[1] = 0.5;
+
+      gam0[2] = 1.0/3.0;
+      gam1[2] = 2.0/3.0;
+      beta[2] = 1.0/6.0;
+
+      gam0[3] = 1.0;
+      gam1[3] = 0.0;
+      beta[3] = 0.5;
+    } else if (integrator == "ssprk10_4") {
+      // SSPRK (10,4): Ketcheson (2008) pseudocode 3, written in 2S form
+      // Explicit ten-stage, fourth-order SSPRK with SSP coefficient 6 (c_eff = 3/5).
+      // The two register combinations after stage 5 of the original low-storage
+      // algorithm are folded into gam0/gam1 of stage 5, delta of stage 6 (which
+      // updates u1), and gam0/gam1 of stage 10.
+      nimp_stages = 0;
+      nexp_stages = 10;
+      cfl_limit = 6.0;
+      for (int l=0; l<(nexp_stages); ++l) {
+        gam0[l] = 1.0;
+        gam1[l] = 0.0;
+        beta[l] = 1.0/6.0;
+      }
+      gam0[4] = 0.4;
+      gam1[4] = 0.6;
+      beta[4] = 1.0/15.0;
+
+      gam0[9] = 0.6;
+      gam1[9] = -0.5;
+      beta[9] = 0.1;
+
+      delta[0] = 1.0;
+      delta[5] = -1.8;
     } else if (integrator == "imex2") {
       // IMEX-SSP2(3,2,2): Pareschi & Russo (2005) Table III.
       // two-stage explicit, three-stage implicit, second-order ImEx
@@ -273,12 +332,69 @@ Driver::Driver(ParameterInput *pin, Mesh *pmesh, Real wtlim, Kokkos::Timer* ptim
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
          << std::endl << "integrator=" << integrator << " not implemented. "
-         << "Valid choices are [rk1,rk2,rk3,rk4,imex2,imex3]." << std::endl;
+         << "Valid choices are [rk1,rk2,rk3,rk4,ssprk4_3,ssprk10_4,imex2,imex2+,imex3]."
+         << std::endl;
       exit(EXIT_FAILURE);
     }
+
+    // Super-time-stepping of viscosity and conduction, operator split from the
+    // hyperbolic update above.  Weights are set each cycle in SetRKL2Weights().
+    sts_integrator = pin->GetOrAddString("time", "sts_integrator", "none");
+    if (sts_integrator != "none" && sts_integrator != "rkl2") {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+         << std::endl << "sts_integrator=" << sts_integrator << " not implemented. "
+         << "Valid choices are [none,rkl2]." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    // STS is only used when Hydro or MHD have viscosity and/or conduction
+    hydro::Hydro *phyd = pmesh->pmb_pack->phydro;
+    mhd::MHD *pmhd = pmesh->pmb_pack->pmhd;
+    if (!((phyd != nullptr && phyd->use_sts) || (pmhd != nullptr && pmhd->use_sts))) {
+      sts_integrator = "none";
+    }
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn Driver::SetRKL2Weights()
+//! \brief Sets weights of each stage of the second-order Runge-Kutta-Legendre (RKL2)
+//! super-time-stepping method of Meyer, Balsara & Aslam (2014, JCP 257, 594), eqs 16-17.
+//! Each stage j=1...s computes
+//!
+//!    Y_j = mu_j*Y_{j-1} + nu_j*Y_{j-2} + (1-mu_j-nu_j)*Y_0
+//!        + mut_j*dt*L(Y_{j-1}) + gamt_j*dt*L(Y_0),
+//!
+//! where L is the diffusion operator.  Stage 1 is written in the same form with mu=1.
+
+void Driver::SetRKL2Weights(int nstages) {
+  nsts_stages = nstages;
+  sts_mu.resize(nstages);
+  sts_nu.resize(nstages);
+  sts_mut.resize(nstages);
+  sts_gamt.resize(nstages);
+
+  Real s = static_cast<Real>(nstages);
+  Real w1 = 4.0/(s*s + s - 2.0);
+  // b_j for j=0,1,2 are all 1/3
+  auto b = [](int j) -> Real {
+    if (j < 3) return 1.0/3.0;
+    return static_cast<Real>(j*j + j - 2)/static_cast<Real>(2*j*(j + 1));
+  };
+
+  sts_mu[0] = 1.0;
+  sts_nu[0] = 0.0;
+  sts_mut[0] = b(1)*w1;
+  sts_gamt[0] = 0.0;
+  for (int j=2; j<=nstages; ++j) {
+    Real rj = static_cast<Real>(j);
+    sts_mu[j-1] = ((2.0*rj - 1.0)/rj)*b(j)/b(j-1);
+    sts_nu[j-1] = -((rj - 1.0)/rj)*b(j)/b(j-2);
+    sts_mut[j-1] = sts_mu[j-1]*w1;
+    sts_gamt[j-1] = -(1.0 - b(j-1))*sts_mut[j-1];
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn Driver::ExecuteTaskList()
 //! \brief Perform tasks over all MeshBlocks for the TaskList specified by string "tl".
@@ -331,6 +447,9 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     if (pz4c != nullptr) {
       (void) pmesh->pmb_pack->pz4c->NewTimeStep(this, nexp_stages);
     }
+    if (pmesh->pmb_pack->ppart != nullptr) {
+      (void) pmesh->pmb_pack->ppart->NewTimeStep(this, nexp_stages);
+    }
 
     pmesh->NewTimeStep(tlim);
   }
@@ -343,9 +462,16 @@ void Driver::Initialize(Mesh *pmesh, ParameterInput *pin, Outputs *pout, bool re
     }
   }
 
+  // With <z4c>/store_adm = false the ADM variables were only needed to set up the
+  // initial data; from now on they are computed from the Z4c variables when needed.
+  if (pz4c != nullptr && !(pmesh->pmb_pack->padm->store_z4c_adm)) {
+    pmesh->pmb_pack->padm->ReleaseStorage();
+  }
+
   //---- Step 4.  Initialize various counters, timers, etc.
   run_time_.reset();
   nmb_updated_ = 0;
+  if (time_evolution != TimeEvolution::tstatic) {InitProfiling(pin, pmesh);}
 
   // allocate memory for stiff source terms with ImEx integrators
   // only implemented for ion-neutral two fluid for now
@@ -389,8 +515,14 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
     }
     while ((pmesh->time < tlim) && (pmesh->ncycle < nlim || nlim < 0) &&
            (elapsed_time < wall_time)) {
+      // Complete the global minimum of the new timestep started at the end of the last
+      // cycle.  This is the first use of dt in this cycle.
+      pmesh->FinishNewTimeStep(tlim);
       if (global_variable::my_rank == 0) {OutputCycleDiagnostics(pmesh);}
 
+      // Decide whether any output made at the end of this cycle needs Z4c constraints
+      if (pmesh->pmb_pack->pz4c != nullptr) {ScheduleZ4cConstraints(pmesh, pout);}
+
       // Execute TaskLists
       // Work before time integrator indicated by "0" in stage
       ExecuteTaskList(pmesh, "before_timeintegrator", 0);
@@ -402,15 +534,37 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
         ExecuteTaskList(pmesh, "after_stagen", stage);
       }
 
+      // Operator-split super-time-stepping of diffusion over the full timestep.  The
+      // number of stages s satisfies the RKL2 stability limit dt <= dt_diff*(s^2+s-2)/4
+      if (sts_integrator == "rkl2") {
+        Real ratio = pmesh->dt/pmesh->dt_diff;
+        int nstages = static_cast<int>(std::ceil(0.5*(std::sqrt(9.0+16.0*ratio) - 1.0)));
+        SetRKL2Weights(std::max(nstages, 2));
+        for (int stage=1; stage<=(nsts_stages); ++stage) {
+          ExecuteTaskList(pmesh, "before_sts", stage);
+          ExecuteTaskList(pmesh, "sts", stage);
+          ExecuteTaskList(pmesh, "after_sts", stage);
+        }
+        nsts_updated_ += nsts_stages;
+      }
+
       // Work after time integrator indicated by "1" in stage
       ExecuteTaskList(pmesh, "after_timeintegrator", 1);
 
+      // The new timestep is known now, so start its global (MPI) minimum.  It is only
+      // completed at the start of the next cycle, so it overlaps outputs and AMR below.
+      pmesh->StartNewTimeStep();
+
       // Work outside of TaskLists:
       // increment time, ncycle, etc.
       pmesh->time = pmesh->time + pmesh->dt;
       pmesh->ncycle++;
       nmb_updated_ += pmesh->nmb_total;
       npart_updated_ += pmesh->nprtcl_total;
+      // record time spent in each TaskList every profile_ncycle cycles
+      if (profile_tasks && profile_ncycle > 0 && (pmesh->ncycle % profile_ncycle) == 0) {
+        OutputProfilingTimeline(pmesh);
+      }
       // load balancing efficiency
       if (global_variable::nranks > 1) {
         int minnmb = std::numeric_limits<int>::max();
@@ -423,29 +577,27 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
       // Test for/make outputs
       for (auto &out : pout->pout_list) {
-        // compare at floating point (32-bit) precision to reduce effect of round off
-        float time_32 = static_cast<float>(pmesh->time);
-        float next_32 = static_cast<float>(out->out_params.last_time+out->out_params.dt);
-        float tlim_32 = static_cast<float>(tlim);
-        int &dcycle_ = out->out_params.dcycle;
-
-        if (((out->out_params.dt > 0.0) && ((time_32 >= next_32) && (time_32<tlim_32))) ||
-            ((dcycle_ > 0) && ((pmesh->ncycle)%(dcycle_) == 0)) ) {
+        if (OutputDue(out, pmesh->time, pmesh->ncycle)) {
           out->LoadOutputData(pmesh);
           out->WriteOutputFile(pmesh, pin);
         }
       }
 
-      // AMR
-      if (pmesh->adaptive) {pmesh->pmr->AdaptiveMeshRefinement(this, pin);}
-      // compute new timestep AFTER all Meshblocks refined/derefined
-      pmesh->NewTimeStep(tlim);
+      // AMR.  If MeshBlocks were refined/derefined, restart the minimum of the new
+      // timestep with the timesteps computed on the new mesh
+      if (pmesh->adaptive) {
+        int nregrid = pmesh->pmr->nregrid;
+        pmesh->pmr->AdaptiveMeshRefinement(this, pin);
+        if (pmesh->pmr->nregrid != nregrid) {pmesh->StartNewTimeStep();}
+      }
 
       // Update wall clock time if needed.
       if (wall_time > 0.) {
         elapsed_time = UpdateWallClock();
       }
     }  // end while
+    // complete the minimum started in the last cycle, so dt is current in final outputs
+    pmesh->FinishNewTimeStep(tlim);
   }    // end of (time_evolution != tstatic) clause
   return;
 }
@@ -456,6 +608,14 @@ void Driver::Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 //!  and printing diagnostic messages
 
 void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
+  // Z4c constraints may have been skipped in the last cycle (e.g. when terminating on
+  // the wall clock limit), so compute them before the final outputs
+  z4c::Z4c *pz4c = pmesh->pmb_pack->pz4c;
+  if (pz4c != nullptr && !(pz4c->con_needed)) {
+    pz4c->con_needed = true;
+    (void) pz4c->ADMConstraints_(this, nexp_stages);
+  }
+
   // cycle through output Types and load data / write files
   //  This design allows for asynchronous outputs to implemented in the future.
   for (auto &out : pout->pout_list) {
@@ -470,12 +630,18 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
 
   float exe_time = run_time_.seconds();
 
+  // reduce task timers over all ranks and write profiling summary
+  if (profile_tasks) {OutputProfilingSummary(pmesh);}
+
   if (time_evolution != TimeEvolution::tstatic) {
 #if MPI_PARALLEL_ENABLED
     // Collect number of MeshBlocks communicated during load balancing across all ranks
     if (pmesh->adaptive) {
       MPI_Allreduce(MPI_IN_PLACE, &(pmesh->pmr->nmb_sent_thisrank), 1, MPI_INT, MPI_SUM,
                     MPI_COMM_WORLD);
+      // Regrids are collective, so report time on slowest rank
+      MPI_Allreduce(MPI_IN_PLACE, &(pmesh->pmr->regrid_time), 1, MPI_DOUBLE, MPI_MAX,
+                    MPI_COMM_WORLD);
     }
 #endif
     if (global_variable::my_rank == 0) {
@@ -496,6 +662,12 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
         std::cout << std::endl << "Current number of MeshBlocks = " << pmesh->nmb_total
           << std::endl << pmesh->pmr->nmb_created << " MeshBlocks created, "
           << pmesh->pmr->nmb_deleted << " deleted by AMR" << std::endl;
+        std::cout << pmesh->pmr->nregrid << " regrids";
+        if (pmesh->pmr->nregrid > 0) {
+          std::cout << ", max time per regrid over ranks = "
+                    << pmesh->pmr->regrid_time/pmesh->pmr->nregrid << " s";
+        }
+        std::cout << std::endl;
 #if MPI_PARALLEL_ENABLED
         std::cout << pmesh->pmr->nmb_sent_thisrank << " communicated for load balancing, "
           <<"load balancing efficiency = " << (lb_efficiency_/pmesh->ncycle) << std::endl;
@@ -510,6 +682,10 @@ void Driver::Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout) {
       float pups = static_cast<float>(npart_updated_) / exe_time;
 
       std::cout << std::endl << "MeshBlock-cycles = " << nmb_updated_ << std::endl;
+      if (sts_integrator == "rkl2" && pmesh->ncycle > 0) {
+        std::cout << "STS stages per cycle = "
+                  << static_cast<double>(nsts_updated_)/pmesh->ncycle << std::endl;
+      }
       std::cout << "cpu time used  = " << exe_time << std::endl;
       std::cout << "zone-cycles/cpu_second = " << zcps << std::endl;
       std::cout << "particle-updates/cpu_second = " << pups << std::endl;
@@ -553,10 +729,46 @@ Real Driver::UpdateWallClock() {
   return tnow;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn Driver::OutputDue()
+//! \brief Returns true if output should be made at the end of a cycle that reaches the
+//! given time and ncycle.
+
+bool Driver::OutputDue(BaseTypeOutput *pout, Real time, int ncycle) {
+  // compare at floating point (32-bit) precision to reduce effect of round off
+  float time_32 = static_cast<float>(time);
+  float next_32 = static_cast<float>(pout->out_params.last_time+pout->out_params.dt);
+  float tlim_32 = static_cast<float>(tlim);
+  int &dcycle_ = pout->out_params.dcycle;
+
+  return (((pout->out_params.dt > 0.0) && ((time_32 >= next_32) && (time_32<tlim_32))) ||
+          ((dcycle_ > 0) && (ncycle%(dcycle_) == 0)));
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::ScheduleZ4cConstraints()
+//! \brief Sets Z4c::con_needed if any output that reads the ADM constraints (history,
+//! or mesh data containing con_* variables) will be made at the end of the coming cycle.
+//! No refinement criterion in z4c_amr.cpp uses the constraints.  Must be called before
+//! the TaskLists are executed, when time and ncycle have not yet been incremented.
+
+void Driver::ScheduleZ4cConstraints(Mesh *pm, Outputs *pout) {
+  z4c::Z4c *pz4c = pm->pmb_pack->pz4c;
+  pz4c->con_needed = false;
+  Real next_time = pm->time + pm->dt;
+  for (auto &out : pout->pout_list) {
+    if (out->uses_z4c_con && OutputDue(out, next_time, pm->ncycle + 1)) {
+      pz4c->con_needed = true;
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn Driver::InitBoundaryValuesAndPrimitives()
 //! \brief Sets boundary conditions on conserved and initializes primitives.  Used both
-//! on initialization, and when new MBs created with AMR.
+//! on initialization, and when new MBs created with AMR.  After AMR, ghost zones (except
+//! those prolongated) and primitives are kept in MBs flagged in MeshBlock::mb_unchanged.
 
 void Driver::InitBoundaryValuesAndPrimitives(Mesh *pm) {
   // Note: with MPI, sends on ALL MBs must be complete before receives execute
@@ -13,13 +13,18 @@
 // called in Finalize().
 
 #include <ctime>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "parameter_input.hpp"
 #include "outputs/outputs.hpp"
 #include "pgen/pgen.hpp"
 
+// maximum number of explicit stages in any of the RK integrators
+#define NEXP_STAGES_MAX 10
+
 //----------------------------------------------------------------------------------------
 //! \class Driver
 
@@ -40,13 +45,23 @@ class Driver {
   std::string integrator;          // integrator name (rk1, rk2, rk3)
   int nimp_stages;                 // number of implicit stages (ImEx only)
   int nexp_stages;                 // number of explicit stages (both SSP-RK and ImEx)
-  Real gam0[4], gam1[4], beta[4];  // weights and fractional timestep per explicit stage
-  Real delta[4];                   // weights for updating the intermediate stage (u1)
+  Real gam0[NEXP_STAGES_MAX];      // weights of u0 per explicit stage
+  Real gam1[NEXP_STAGES_MAX];      // weights of u1 per explicit stage
+  Real beta[NEXP_STAGES_MAX];      // fractional timestep per explicit stage
+  Real delta[NEXP_STAGES_MAX];     // weights for updating the intermediate stage (u1)
   Real a_twid[4][4], a_impl;       // matrix elements for implicit stages in ImEx
   Real cfl_limit;                  // maximum CFL number for integrator
   Real gamma;                      // gamma value for the IMEX_new integrator
+  // variables for operator-split RKL2 super-time-stepping (STS) of diffusion
+  std::string sts_integrator;      // STS integrator name (none, rkl2)
+  int nsts_stages;                 // number of STS stages in current cycle
+  std::vector<Real> sts_mu, sts_nu;       // weights of Y_{j-1}, Y_{j-2} per STS stage
+  std::vector<Real> sts_mut, sts_gamt;    // weights of dt*L(Y_{j-1}), dt*L(Y_0)
   Kokkos::Timer* pwall_clock_;     // timer for tracking the wall clock
   Real wall_time;
+  // optional timing of tasks (implemented in profiling.cpp)
+  bool profile_tasks = false;      // accumulate time spent in every task
+  int profile_ncycle = 0;          // cycles between profiling timeline records
 
   // functions
   void ExecuteTaskList(Mesh *pm, std::string tl, int stage);
@@ -54,13 +69,22 @@ class Driver {
   void Execute(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
   void Finalize(Mesh *pmesh, ParameterInput *pin, Outputs *pout);
   void InitBoundaryValuesAndPrimitives(Mesh *pm);
+  void SetRKL2Weights(int nstages);
+  void InitProfiling(ParameterInput *pin, Mesh *pm);
+  void OutputProfilingTimeline(Mesh *pm);
+  void OutputProfilingSummary(Mesh *pm);
 
  private:
   Kokkos::Timer run_time_;      // generalized timer for cpu/gpu/etc
   std::uint64_t nmb_updated_;   // running total of MB updated during run
   std::uint64_t npart_updated_; // running total of particles updated during run
+  std::uint64_t nsts_updated_;  // running total of STS stages taken during run
   float lb_efficiency_;         // measure of how efficient was load balancing
+  std::string prof_basename_;                // basename of profiling output files
+  std::map<std::string, double> prof_last_;  // TaskList times at last timeline record
   void OutputCycleDiagnostics(Mesh *pm);
   Real UpdateWallClock();
+  bool OutputDue(BaseTypeOutput *pout, Real time, int ncycle);
+  void ScheduleZ4cConstraints(Mesh *pm, Outputs *pout);
 };
 #endif // DRIVER_DRIVER_HPP_
@@ -0,0 +1,170 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file profiling.cpp
+//! \brief Implements optional timing of every task in the TaskLists stored in the
+//! MeshBlockPack.  Enabled with <job>/profile = tasks (host timers only) or precise (the
+//! device is fenced before and after each task, so kernels are charged to the task that
+//! launched them at the cost of losing asynchrony).  At the end of the run the run and
+//! wait times of each task are reduced over all ranks (min/max/mean) and written to
+//! "basename.prof.json".  With <job>/profile_ncycle = N > 0 the time spent in each
+//! TaskList is also appended every N cycles to "basename.prof_timeline.jsonl".
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "driver.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::InitProfiling()
+//! \brief Reads profiling options and enables timers in all TaskLists
+
+void Driver::InitProfiling(ParameterInput *pin, Mesh *pm) {
+  std::string mode = pin->GetOrAddString("job", "profile", "none");
+  if (mode.compare("none") == 0) return;
+  if (mode.compare("tasks") != 0 && mode.compare("precise") != 0) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<job>/profile = '" << mode << "' not implemented. "
+              << "Valid choices are [none,tasks,precise]." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  profile_tasks = true;
+  profile_ncycle = pin->GetOrAddInteger("job", "profile_ncycle", 0);
+  prof_basename_ = pin->GetString("job", "basename");
+
+  for (auto &it : pm->pmb_pack->tl_map) {
+    it.second->EnableProfiling(mode.compare("precise") == 0);
+    prof_last_[it.first] = it.second->TotalRunTime();
+  }
+
+  // start a new timeline file
+  if (profile_ncycle > 0 && global_variable::my_rank == 0) {
+    std::string fname = prof_basename_ + ".prof_timeline.jsonl";
+    FILE *pfile;
+    if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+          << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+      std::exit(EXIT_FAILURE);
+    }
+    std::fclose(pfile);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::OutputProfilingTimeline()
+//! \brief Appends one JSON record with the max and mean (over ranks) time spent in each
+//! TaskList since the previous record.  Must be called by all ranks.
+
+void Driver::OutputProfilingTimeline(Mesh *pm) {
+  int nlist = pm->pmb_pack->tl_map.size();
+  std::vector<double> dt_list(nlist), dt_max(nlist), dt_sum(nlist);
+  int l = 0;
+  for (auto &it : pm->pmb_pack->tl_map) {
+    double t = it.second->TotalRunTime();
+    dt_list[l++] = t - prof_last_[it.first];
+    prof_last_[it.first] = t;
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Reduce(dt_list.data(), dt_max.data(), nlist, MPI_DOUBLE, MPI_MAX, 0,
+             MPI_COMM_WORLD);
+  MPI_Reduce(dt_list.data(), dt_sum.data(), nlist, MPI_DOUBLE, MPI_SUM, 0,
+             MPI_COMM_WORLD);
+#else
+  dt_max = dt_list;
+  dt_sum = dt_list;
+#endif
+  if (global_variable::my_rank != 0) return;
+
+  std::string fname = prof_basename_ + ".prof_timeline.jsonl";
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(), "a")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  double nranks = static_cast<double>(global_variable::nranks);
+  std::fprintf(pfile, "{\"cycle\": %d, \"time\": %.8e, \"lists\": {", pm->ncycle,
+               static_cast<double>(pm->time));
+  l = 0;
+  for (auto &it : pm->pmb_pack->tl_map) {
+    if (l > 0) {std::fprintf(pfile, ", ");}
+    std::fprintf(pfile, "\"%s\": {\"max\": %.6e, \"mean\": %.6e}", it.first.c_str(),
+                 dt_max[l], dt_sum[l]/nranks);
+    l++;
+  }
+  std::fprintf(pfile, "}}\n");
+  std::fclose(pfile);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn Driver::OutputProfilingSummary()
+//! \brief Reduces run and wait time of every task over all ranks and writes JSON summary.
+//! All ranks have the same TaskLists, so tasks are matched by their position.  Tasks
+//! added without a name are labelled by their position in the TaskList.
+
+void Driver::OutputProfilingSummary(Mesh *pm) {
+  // pack run and wait times of all tasks into one array
+  std::vector<double> tloc;
+  for (auto &it : pm->pmb_pack->tl_map) {
+    for (auto &task : it.second->GetTasks()) {
+      tloc.push_back(task.run_time);
+      tloc.push_back(task.wait_time);
+    }
+  }
+  int n = tloc.size();
+  std::vector<double> tmin(tloc), tmax(tloc), tsum(tloc);
+#if MPI_PARALLEL_ENABLED
+  MPI_Reduce(tloc.data(), tmin.data(), n, MPI_DOUBLE, MPI_MIN, 0, MPI_COMM_WORLD);
+  MPI_Reduce(tloc.data(), tmax.data(), n, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+  MPI_Reduce(tloc.data(), tsum.data(), n, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+#endif
+  if (global_variable::my_rank != 0) return;
+
+  std::string fname = prof_basename_ + ".prof.json";
+  FILE *pfile;
+  if ((pfile = std::fopen(fname.c_str(), "w")) == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+        << std::endl << "Output file '" << fname << "' could not be opened" <<std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  double nranks = static_cast<double>(global_variable::nranks);
+  std::fprintf(pfile, "{\n  \"nranks\": %d,\n  \"ncycle\": %d,\n",
+               global_variable::nranks, pm->ncycle);
+  std::fprintf(pfile, "  \"cpu_time\": %.6e,\n  \"tasks\": [", run_time_.seconds());
+  int i = 0;
+  for (auto &it : pm->pmb_pack->tl_map) {
+    int ntask = 0;
+    for (auto &task : it.second->GetTasks()) {
+      ntask++;
+      std::string name = task.GetName();
+      if (name.empty()) {name = "task" + std::to_string(ntask);}
+      std::fprintf(pfile, "%s\n    {\"list\": \"%s\", \"name\": \"%s\",",
+                   (i == 0)? "" : ",", it.first.c_str(), name.c_str());
+      std::fprintf(pfile, " \"ncomplete\": %s,", std::to_string(task.ncomplete).c_str());
+      std::fprintf(pfile, " \"run\": {\"min\": %.6e, \"max\": %.6e, \"mean\": %.6e},",
+                   tmin[i], tmax[i], tsum[i]/nranks);
+      std::fprintf(pfile, " \"wait\": {\"min\": %.6e, \"max\": %.6e, \"mean\": %.6e}}",
+                   tmin[i+1], tmax[i+1], tsum[i+1]/nranks);
+      i += 2;
+    }
+  }
+  std::fprintf(pfile, "\n  ]\n}\n");
+  std::fclose(pfile);
+  std::cout << "task profile written to " << fname << std::endl;
+  return;
+}
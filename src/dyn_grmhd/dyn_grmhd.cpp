@@ -420,7 +420,7 @@ TaskStatus DynGRMHD::SetTmunu(Driver *pdrive, int stage) {
 
   int nmb = pmy_pack->nmb_thispack;
 
-  auto &adm = pmy_pack->padm->adm;
+  auto adm = pmy_pack->padm->GetADMView();
   auto &tmunu = pmy_pack->ptmunu->tmunu;
   //auto &nhyd = pmy_pack->pmhd->nmhd;
   //int &nscal = pmy_pack->pmhd->nscalars;
@@ -507,7 +507,7 @@ void DynGRMHDPS<EOSPolicy, ErrorPolicy>::AddCoordTermsEOS(const DvceArray5D<Real
 
   int nmb = pmy_pack->nmb_thispack;
 
-  auto &adm = pmy_pack->padm->adm;
+  auto adm = pmy_pack->padm->GetADMView();
   auto &eos_ = eos.ps.GetEOS();
   //auto &tmunu = pmy_pack->ptmunu->tmunu;
 
@@ -32,6 +32,7 @@ struct EOS_Data {
   Real dfloor, pfloor, tfloor, sfloor;  // density, pressure, temperature, entropy floors
   Real gamma_max;    // ceiling on Lorentz factor in SR/GR
   Real sigma_max;    // ceiling on magnetization in MHD
+  bool c2p_warm_start = false;  // seed GR C2P root bracket from previous primitives
 
   // IDEAL GAS PRESSURE: converts primitive variable (either internal energy density e
   // or temperature e/d) into pressure.
@@ -192,6 +193,11 @@ struct EOS_Data {
   }
 };
 
+// number of bins in histogram of GR C2P iteration counts.  Bin b holds cells that needed
+// between 2^b-1 and 2^(b+1)-2 iterations (summed over both root-finding stages); the
+// last bin holds all larger counts.
+#define NC2P_HIST 6
+
 //----------------------------------------------------------------------------------------
 //! \class EquationOfState
 //! \brief Abstract base class for EOS.
@@ -203,6 +209,7 @@ class EquationOfState {
 
   MeshBlockPack* pmy_pack;
   EOS_Data eos_data;
+  int c2p_iter_hist[NC2P_HIST] = {0};  // C2P iterations, filled only with c2p_warm_start
 
   // virtual functions to convert cons to prim in either Hydro or MHD (depending on
   // arguments), overwritten in derived eos classes
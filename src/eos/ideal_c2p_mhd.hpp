@@ -123,11 +123,15 @@ Real Equation44(const Real mu, const Real b2, const Real rpar, const Real r, con
 //! \brief Converts single state of conserved variables into primitive variables for
 //! special relativistic MHD with an ideal gas EOS. Note input CONSERVED state contains
 //! cell-centered magnetic fields, but PRIMITIVE state returned via arguments does not.
+//! If mu_guess = 1/(hW) > 0 is supplied (e.g. from the primitives of the previous stage),
+//! a narrow bracket about it is tried first, falling back to the full bracket search.
+//! If sum_iter is supplied it returns the total iterations of both root-finding stages.
 
 KOKKOS_INLINE_FUNCTION
 void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, Real rpar,
                           HydPrim1D &w, bool &dfloor_used, bool &efloor_used,
-                          bool &c2p_failure, int &max_iter) {
+                          bool &c2p_failure, int &max_iter, const Real mu_guess = -1.0,
+                          int *sum_iter = nullptr) {
   // Parameters
   const Real dfloor_ = fmax(eos.dfloor, b2/eos.sigma_max);
   const int max_iterations = 25;
@@ -158,53 +162,74 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
   b2 /= u.d;
   rpar *= isqrtd;
 
-  // Need to find initial bracket. Requires separate solve
-  Real zm=0.;
-  Real zp=1.; // This is the lowest specific enthalpy admitted by the EOS
+  Real zm, zp, fm, fp;
+  int iterations, iter;
+  int iter_bracket = 0;
+  Real z;
+
+  // Warm start: accept narrow bracket [zm,zp] about guess only if zp lies below the
+  // upper bound of eq 49 (so root is unique) and eq 44 changes sign across the bracket
+  bool warm_bracket = false;
+  if (mu_guess > 0.0) {
+    const Real warm_width = 1.0e-2;
+    zm = mu_guess*(1.0 - warm_width);
+    zp = fmin(mu_guess*(1.0 + warm_width), 1.0);
+    if (Equation49(zp, b2, rpar, r, q) < 0.0) {
+      fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
+      fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+      warm_bracket = (fm*fp < 0.0);
+    }
+  }
 
-  // Evaluate master function (eq 49) at bracket values
-  Real fm = Equation49(zm, b2, rpar, r, q);
-  Real fp = Equation49(zp, b2, rpar, r, q);
+  if (!(warm_bracket)) {
+    // Need to find initial bracket. Requires separate solve
+    zm=0.;
+    zp=1.; // This is the lowest specific enthalpy admitted by the EOS
 
-  // For simplicity on the GPU, find roots using the false position method
-  int iterations = max_iterations;
-  // If bracket within tolerances, don't bother doing any iterations
-  if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
-    iterations = -1;
-  }
-  Real z = 0.5*(zm + zp);
+    // Evaluate master function (eq 49) at bracket values
+    fm = Equation49(zm, b2, rpar, r, q);
+    fp = Equation49(zp, b2, rpar, r, q);
 
-  int iter;
-  for (iter=0; iter<iterations; ++iter) {
-    z =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
-    Real f = Equation49(z, b2, rpar, r, q);
-    // Quit if convergence reached
-    // NOTE(@ermost): both z and f are of order unity
-    if ((fabs(zm-zp) < tol) || (fabs(f) < tol)) {
-      break;
+    // For simplicity on the GPU, find roots using the false position method
+    iterations = max_iterations;
+    // If bracket within tolerances, don't bother doing any iterations
+    if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
+      iterations = -1;
     }
-    // assign zm-->zp if root bracketed by [z,zp]
-    if (f*fp < 0.0) {
-      zm = zp;
-      fm = fp;
-      zp = z;
-      fp = f;
-    } else {  // assign zp-->z if root bracketed by [zm,z]
-      fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
-      zp = z;
-      fp = f;
+    z = 0.5*(zm + zp);
+
+    for (iter=0; iter<iterations; ++iter) {
+      z =  (zm*fp - zp*fm)/(fp-fm);  // linear interpolation to point f(z)=0
+      Real f = Equation49(z, b2, rpar, r, q);
+      // Quit if convergence reached
+      // NOTE(@ermost): both z and f are of order unity
+      if ((fabs(zm-zp) < tol) || (fabs(f) < tol)) {
+        break;
+      }
+      // assign zm-->zp if root bracketed by [z,zp]
+      if (f*fp < 0.0) {
+        zm = zp;
+        fm = fp;
+        zp = z;
+        fp = f;
+      } else {  // assign zp-->z if root bracketed by [zm,z]
+        fm = 0.5*fm; // 1/2 comes from "Illinois algorithm" to accelerate convergence
+        zp = z;
+        fp = f;
+      }
     }
-  }
-  max_iter = (iter > max_iter) ? iter : max_iter;
+    max_iter = (iter > max_iter) ? iter : max_iter;
+    iter_bracket = iter;
 
-  // Found brackets. Now find solution in bounded interval, again using the
-  // false position method
-  zm= 0.;
-  zp= z;
+    // Found brackets. Now find solution in bounded interval, again using the
+    // false position method
+    zm= 0.;
+    zp= z;
 
-  // Evaluate master function (eq 44) at bracket values
-  fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
-  fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+    // Evaluate master function (eq 44) at bracket values
+    fm = Equation44(zm, b2, rpar, r, q, u.d, eos);
+    fp = Equation44(zp, b2, rpar, r, q, u.d, eos);
+  }
 
   iterations = max_iterations;
   if ((fabs(zm-zp) < tol) || ((fabs(fm) + fabs(fp)) < 2.0*tol)) {
@@ -233,6 +258,7 @@ void SingleC2P_IdealSRMHD(MHDCons1D &u, const EOS_Data &eos, Real s2, Real b2, R
     }
   }
   max_iter = (iter > max_iter) ? iter : max_iter;
+  if (sum_iter != nullptr) {*sum_iter = iter_bracket + iter;}
 
   // check if convergence is established within max_iterations.  If not, trigger a C2P
   // failure and return floored density, pressure, and primitive velocities. Future
@@ -17,6 +17,17 @@
 #include "coordinates/cartesian_ks.hpp"
 #include "coordinates/cell_locations.hpp"
 
+// histogram of C2P iteration counts accumulated in reduction
+using C2PHist = array_sum::array_type<int,(NC2P_HIST)>;
+namespace Kokkos { //reduction identity must be defined in Kokkos namespace
+template<>
+struct reduction_identity< C2PHist > {
+  KOKKOS_FORCEINLINE_FUNCTION static C2PHist sum() {
+    return C2PHist();
+  }
+};
+}
+
 //----------------------------------------------------------------------------------------
 // ctor: also calls EOS base class constructor
 
@@ -29,6 +40,7 @@ IdealGRMHD::IdealGRMHD(MeshBlockPack *pp, ParameterInput *pin) :
   eos_data.use_t = false;
   eos_data.gamma_max = pin->GetOrAddReal("mhd","gamma_max",(FLT_MAX));  // gamma ceiling
   eos_data.sigma_max = pin->GetOrAddReal("mhd","sigma_max",(FLT_MAX));  // sigma ceiling
+  eos_data.c2p_warm_start = pin->GetOrAddBoolean("mhd","c2p_warm_start",false);
 }
 
 //----------------------------------------------------------------------------------------
@@ -47,12 +59,15 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
+  auto &unchanged = pmy_pack->pmb->mb_unchanged;
   auto &fofc_ = pmy_pack->pmhd->fofc;
   auto eos = eos_data;
   Real gm1 = eos_data.gamma - 1.0;
 
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   auto &use_excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &excision_floor_ = pmy_pack->pcoord->excision_floor;
   auto &excision_flux_ = pmy_pack->pcoord->excision_flux;
@@ -64,15 +79,22 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
   const int nkji = (ku - kl + 1)*nji;
   const int nmkji = nmb*nkji;
 
+  // histogram of C2P iterations is only accumulated when diagnosing the warm start
+  const bool hist_on = eos.c2p_warm_start && !(only_testfloors);
+
   int nfloord_=0, nfloore_=0, nceilv_=0, nfail_=0, maxit_=0;
-  Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
-  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it) {
+  C2PHist hist_;
+  auto c2p_kernel =
+  KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf, int &max_it,
+                C2PHist &hist) {
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
     int j = (idx - m*nkji - k*nji)/ni;
     int i = (idx - m*nkji - k*nji - j*ni) + il;
     j += jl;
     k += kl;
+    // skip MBs whose primitives are kept after a regrid
+    if (unchanged.d_view(m)) return;
 
     // load single state conserved variables
     MHDCons1D u;
@@ -109,12 +131,16 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (cache) {
+      LoadMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     HydPrim1D w;
     bool dfloor_used=false, efloor_used=false;
     bool vceiling_used=false, c2p_failure=false;
-    int iter_used=0;
+    int iter_used=0, iter_sum=0;
 
     // Only execute cons2prim if outside excised region
     bool excised = false;
@@ -140,10 +166,28 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
       Real s2, b2, rpar;
       TransformToSRMHD(u,glower,gupper,s2,b2,rpar,u_sr);
 
+      // estimate mu = 1/(hW) from primitives still stored from previous stage
+      Real mu_guess = -1.0;
+      if (eos.c2p_warm_start && !(only_testfloors)) {
+        Real dold = prim(m,IDN,k,j,i);
+        Real eold = prim(m,IEN,k,j,i);
+        if (dold > 0.0 && eold > 0.0) {
+          const Real &uu1 = prim(m,IVX,k,j,i);
+          const Real &uu2 = prim(m,IVY,k,j,i);
+          const Real &uu3 = prim(m,IVZ,k,j,i);
+          Real uu_sq = glower[1][1]*uu1*uu1 +2.0*glower[1][2]*uu1*uu2
+                     + 2.0*glower[1][3]*uu1*uu3 + glower[2][2]*uu2*uu2
+                     + 2.0*glower[2][3]*uu2*uu3 + glower[3][3]*uu3*uu3;
+          Real hold = 1.0 + eos.gamma*eold/dold;
+          mu_guess = 1.0/(hold*sqrt(1.0 + uu_sq));
+        }
+      }
+
       // call c2p function
       // (inline function in ideal_c2p_mhd.hpp file)
       SingleC2P_IdealSRMHD(u_sr, eos, s2, b2, rpar, w,
-                           dfloor_used, efloor_used, c2p_failure, iter_used);
+                           dfloor_used, efloor_used, c2p_failure, iter_used, mu_guess,
+                           &iter_sum);
 
       // apply velocity ceiling if necessary
       Real tmp = glower[1][1]*SQR(w.vx)
@@ -173,6 +217,11 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
       if (vceiling_used) {sumv++;}
       if (c2p_failure) {sumf++;}
       max_it = (iter_used > max_it) ? iter_used : max_it;
+      if (hist_on && !(excised)) {
+        int b = 0;
+        for (int n=iter_sum+1; (n > 1) && (b < (NC2P_HIST)-1); n >>= 1) {++b;}
+        hist.the_array[b]++;
+      }
 
       // store primitive state in 3D array
       prim(m,IDN,k,j,i) = w.d;
@@ -213,8 +262,22 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
         prim(m,n,k,j,i) = cons(m,n,k,j,i)/u.d;
       }
     }
-  }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
-     Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
+  };
+  if (hist_on) {
+    Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    c2p_kernel, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_),
+    Kokkos::Sum<int>(nceilv_), Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_),
+    Kokkos::Sum<C2PHist>(hist_));
+  } else {
+    // same kernel without the histogram reduction
+    Kokkos::parallel_reduce("grmhd_c2p",Kokkos::RangePolicy<>(DevExeSpace(), 0, nmkji),
+    KOKKOS_LAMBDA(const int &idx, int &sumd, int &sume, int &sumv, int &sumf,
+                  int &max_it) {
+      C2PHist hist;
+      c2p_kernel(idx, sumd, sume, sumv, sumf, max_it, hist);
+    }, Kokkos::Sum<int>(nfloord_), Kokkos::Sum<int>(nfloore_), Kokkos::Sum<int>(nceilv_),
+       Kokkos::Sum<int>(nfail_), Kokkos::Max<int>(maxit_));
+  }
 
   // store appropriate counters
   if (only_testfloors) {
@@ -225,6 +288,9 @@ void IdealGRMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &
     pmy_pack->pmesh->ecounter.neos_vceil  += nceilv_;
     pmy_pack->pmesh->ecounter.neos_fail   += nfail_;
     pmy_pack->pmesh->ecounter.maxit_c2p = maxit_;
+    if (hist_on) {
+      for (int b=0; b<(NC2P_HIST); ++b) {c2p_iter_hist[b] += hist_.the_array[b];}
+    }
   }
 
   return;
@@ -243,6 +309,8 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
   auto &size = pmy_pack->pmb->mb_size;
   auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
   auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
+  auto &cache = pmy_pack->pcoord->coord_data.cache_metric;
+  auto &gcc = pmy_pack->pcoord->coord_data.gcc;
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
@@ -264,7 +332,11 @@ void IdealGRMHD::PrimToCons(const DvceArray5D<Real> &prim, const DvceArray5D<Rea
     Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
 
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (cache) {
+      LoadMetricAndInverse(gcc, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Load single state of primitive variables
     MHDPrim1D w;
@@ -35,6 +35,7 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
+  auto &unchanged = pmy_pack->pmb->mb_unchanged;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->phydro->fofc;
 
@@ -52,6 +53,8 @@ void IdealHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     int i = (idx - m*nkji - k*nji - j*ni) + il;
     j += jl;
     k += kl;
+    // skip MBs whose primitives are kept after a regrid
+    if (unchanged.d_view(m)) return;
 
     // load single state conserved variables
     HydCons1D u;
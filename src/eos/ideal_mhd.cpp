@@ -37,6 +37,7 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
   int &nmhd  = pmy_pack->pmhd->nmhd;
   int &nscal = pmy_pack->pmhd->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
+  auto &unchanged = pmy_pack->pmb->mb_unchanged;
   auto &eos = eos_data;
   auto &fofc_ = pmy_pack->pmhd->fofc;
 
@@ -54,6 +55,8 @@ void IdealMHD::ConsToPrim(DvceArray5D<Real> &cons, const DvceFaceFld4D<Real> &b,
     int i = (idx - m*nkji - k*nji - j*ni) + il;
     j += jl;
     k += kl;
+    // skip MBs whose primitives are kept after a regrid
+    if (unchanged.d_view(m)) return;
 
     // load single state conserved variables
     MHDCons1D u;
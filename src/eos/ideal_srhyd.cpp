@@ -59,6 +59,7 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
   int &nhyd  = pmy_pack->phydro->nhydro;
   int &nscal = pmy_pack->phydro->nscalars;
   int &nmb = pmy_pack->nmb_thispack;
+  auto &unchanged = pmy_pack->pmb->mb_unchanged;
   auto &fofc_ = pmy_pack->phydro->fofc;
   auto eos = eos_data;
 
@@ -76,6 +77,8 @@ void IdealSRHydro::ConsToPrim(DvceArray5D<Real> &cons, DvceArray5D<Real> &prim,
     int i = (idx - m*nkji - k*nji - j*ni) + il;
     j += jl;
     k += kl;
+    // skip MBs whose primitives are kept after a regrid
+    if (unchanged.d_view(m)) return;
 
     // load single state conserved variables
     HydCons1D u;
@@ -14,6 +14,7 @@
 #include <iostream>
 #include <cstddef>
 #include <string>
+#include <type_traits>
 
 #include <Kokkos_Core.hpp>
 
@@ -52,7 +53,22 @@ void EOSCompOSE<LogPolicy>::ReadTableFromFile(std::string fname) {
     Kokkos::realloc(m_log_nb, m_nn);
     Kokkos::realloc(m_yq,     m_ny);
     Kokkos::realloc(m_log_t,  m_nt);
-    Kokkos::realloc(m_table, ECNVARS, m_nn, m_ny, m_nt);
+    // On CPU builds with MPI, m_table is kept once per node in shared memory and filled
+    // by the node leader, instead of once per rank.
+    bool node_shared = false, fill_table = true;
+#if MPI_PARALLEL_ENABLED
+    MPI_Win table_win;
+    node_shared = std::is_same<DevMemSpace, HostMemSpace>::value;
+    if (node_shared) {
+      size_t nbytes = sizeof(Real)*ECNVARS*m_nn*m_ny*m_nt;
+      Real *ptable = static_cast<Real*>(
+          TableReader::AllocateNodeShared(nbytes, fill_table, table_win));
+      m_table = DvceArray4D<Real>(ptable, ECNVARS, m_nn, m_ny, m_nt);
+    }
+#endif
+    if (!(node_shared)) {
+      Kokkos::realloc(m_table, ECNVARS, m_nn, m_ny, m_nt);
+    }
 
     // Create host storage to read into
     HostArray1D<Real>::HostMirror host_log_nb = create_mirror_view(m_log_nb);
@@ -98,91 +114,99 @@ void EOSCompOSE<LogPolicy>::ReadTableFromFile(std::string fname) {
       max_T = table_t[m_nt-1];
     }
 
-    { // Read Q1 -> log(P)
-      Real * table_Q1 = table["Q1"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            Real p_current = table_Q1[iflat]*exp2_(host_log_nb(in));
-            host_table(ECLOGP,in,iy,it) = log2_(p_current);
+    if (fill_table) {
+      { // Read Q1 -> log(P)
+        Real * table_Q1 = table["Q1"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              Real p_current = table_Q1[iflat]*exp2_(host_log_nb(in));
+              host_table(ECLOGP,in,iy,it) = log2_(p_current);
+            }
           }
         }
       }
-    }
 
-    { // Read Q2 -> S
-      Real * table_Q2 = table["Q2"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECENT,in,iy,it) = table_Q2[iflat];
+      { // Read Q2 -> S
+        Real * table_Q2 = table["Q2"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              host_table(ECENT,in,iy,it) = table_Q2[iflat];
+            }
           }
         }
       }
-    }
 
-    { // Read Q3-> mu_b
-      Real * table_Q3 = table["Q3"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUB,in,iy,it) = (table_Q3[iflat]+1)*mb;
+      { // Read Q3-> mu_b
+        Real * table_Q3 = table["Q3"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              host_table(ECMUB,in,iy,it) = (table_Q3[iflat]+1)*mb;
+            }
           }
         }
       }
-    }
 
-    { // Read Q4-> mu_q
-      Real * table_Q4 = table["Q4"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUQ,in,iy,it) = table_Q4[iflat]*mb;
+      { // Read Q4-> mu_q
+        Real * table_Q4 = table["Q4"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              host_table(ECMUQ,in,iy,it) = table_Q4[iflat]*mb;
+            }
           }
         }
       }
-    }
 
-    { // Read Q5-> mu_le
-      Real * table_Q5 = table["Q5"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECMUL,in,iy,it) = table_Q5[iflat]*mb;
+      { // Read Q5-> mu_le
+        Real * table_Q5 = table["Q5"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              host_table(ECMUL,in,iy,it) = table_Q5[iflat]*mb;
+            }
           }
         }
       }
-    }
 
-    { // Read Q7-> log(e)
-      Real * table_Q7 = table["Q7"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            Real e_current = mb*(table_Q7[iflat] + 1)*exp2_(host_log_nb(in));
-            host_table(ECLOGE,in,iy,it) = log2_(e_current);
+      { // Read Q7-> log(e)
+        Real * table_Q7 = table["Q7"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              Real e_current = mb*(table_Q7[iflat] + 1)*exp2_(host_log_nb(in));
+              host_table(ECLOGE,in,iy,it) = log2_(e_current);
+            }
           }
         }
       }
-    }
 
-    { // Read cs2-> cs
-      Real * table_cs2 = table["cs2"];
-      for (size_t in=0; in<m_nn; ++in) {
-        for (size_t iy=0; iy<m_ny; ++iy) {
-          for (size_t it=0; it<m_nt; ++it) {
-            size_t iflat = it + m_nt*(iy + m_ny*in);
-            host_table(ECCS,in,iy,it) = sqrt(table_cs2[iflat]);
+      { // Read cs2-> cs
+        Real * table_cs2 = table["cs2"];
+        for (size_t in=0; in<m_nn; ++in) {
+          for (size_t iy=0; iy<m_ny; ++iy) {
+            for (size_t it=0; it<m_nt; ++it) {
+              size_t iflat = it + m_nt*(iy + m_ny*in);
+              host_table(ECCS,in,iy,it) = sqrt(table_cs2[iflat]);
+            }
           }
         }
       }
     }
+#if MPI_PARALLEL_ENABLED
+    // wait until the node leader has filled the shared table
+    if (node_shared) {
+      MPI_Win_fence(0, table_win);
+    }
+#endif
 
     // Copy from host to device
     Kokkos::deep_copy(m_log_nb, host_log_nb);
@@ -223,7 +223,7 @@ class PrimitiveSolverHydro {
     auto &eos_ = ps.GetEOS();
     auto &ps_  = ps;
 
-    auto &adm = pmy_pack->padm->adm;
+    auto adm = pmy_pack->padm->GetADMView();
 
     int &nhyd = pmy_pack->pmhd->nmhd;
     int &nscal = pmy_pack->pmhd->nscalars;
@@ -322,7 +322,7 @@ class PrimitiveSolverHydro {
     auto &dexcise_ = pmy_pack->pcoord->coord_data.dexcise;
     auto &pexcise_ = pmy_pack->pcoord->coord_data.pexcise;
 
-    auto &adm  = pmy_pack->padm->adm;
+    auto adm   = pmy_pack->padm->GetADMView();
     auto &eos_ = ps.GetEOS();
     auto &ps_  = ps;
 
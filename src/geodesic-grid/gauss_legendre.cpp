@@ -16,6 +16,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "coordinates/coordinates.hpp"
+#include "coordinates/adm.hpp"
 #include "gauss_legendre.hpp"
 #include "utils/spherical_harm.hpp"
 #include "utils/legendre_roots.hpp"
@@ -215,7 +216,8 @@ void GaussLegendreGrid::SetInterpolationWeights() {
 //! \fn void GaussLegendreGrid::InterpolateToSphere
 //! \brief interpolate Cartesian data to surface of sphere
 
-void GaussLegendreGrid::InterpolateToSphere(int var_ind, DvceArray5D<Real> &val) {
+template <typename TYPE>
+void GaussLegendreGrid::InterpolateToSphere(int var_ind, TYPE &val) {
   // reinitialize interpolation indices and weights if AMR
   //if (pmy_pack->pmesh->adaptive) {
   //  SetInterpolationIndices();
@@ -261,3 +263,7 @@ void GaussLegendreGrid::InterpolateToSphere(int var_ind, DvceArray5D<Real> &val)
 
   return;
 }
+template void GaussLegendreGrid::InterpolateToSphere<DvceArray5D<Real>>(int var_ind,
+    DvceArray5D<Real> &val);
+template void GaussLegendreGrid::InterpolateToSphere<adm::ADM::ADM_view>(int var_ind,
+    adm::ADM::ADM_view &val);
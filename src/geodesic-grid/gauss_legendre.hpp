@@ -33,8 +33,10 @@ class GaussLegendreGrid {
     void InitializeAngleAndWeights();
     void InitializeRadius();
 
-    // interpolate scalar field to sphere
-    void InterpolateToSphere(int nvars, DvceArray5D<Real> &val);
+    // interpolate scalar field to sphere; val is a DvceArray5D or a functor called as
+    // val(m,n,k,j,i)
+    template <typename TYPE>
+    void InterpolateToSphere(int nvars, TYPE &val);
     DualArray2D<int> interp_indcs;   // indices of MeshBlock and zones therein for interp
     DualArray3D<Real> interp_wghts;  // weights for interpolation
 
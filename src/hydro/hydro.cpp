@@ -35,7 +35,9 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     u1("cons1",1,1,1,1,1),
     uflx("uflx",1,1,1,1,1),
     utest("utest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc",1,1,1,1),
+    u_sts0("u_sts0",1,1,1,1,1),
+    dudt_sts0("dudt_sts0",1,1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -115,7 +117,10 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    // coarse primitives only needed when prolongating primitive variables
+    if (ppack->pmesh->pmr->prolong_prims) {
+      Kokkos::realloc(coarse_w0, nmb, (nhydro+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    }
   }
 
   // allocate boundary buffers for conserved (cell-centered) variables
@@ -286,6 +291,24 @@ Hydro::Hydro(MeshBlockPack *ppack, ParameterInput *pin) :
         Kokkos::realloc(utest, nmb, nhydro, ncells3, ncells2, ncells1);
       }
     }
+
+    // super-time-stepping of diffusion [option already error checked in driver]
+    std::string sts = pin->GetOrAddString("time","sts_integrator","none");
+    if ((sts.compare("rkl2") == 0) && (pvisc != nullptr || pcond != nullptr)) {
+      if (porb_u != nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time>/sts_integrator = " << sts << " cannot be "
+                  << "used with shearing box" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      use_sts = true;
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      int ncells1 = indcs.nx1 + 2*(indcs.ng);
+      int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+      int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+      Kokkos::realloc(u_sts0,    nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+      Kokkos::realloc(dudt_sts0, nmb, (nhydro+nscalars), ncells3, ncells2, ncells1);
+    }
   }
 }
 
@@ -302,4 +325,20 @@ Hydro::~Hydro() {
   delete peos;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t Hydro::DeviceMemoryBytes()
+//! \brief Returns total number of bytes currently allocated on the device for the Views
+//! owned by the Hydro class (excluding boundary buffers and diffusion/source modules).
+
+std::size_t Hydro::DeviceMemoryBytes() const {
+  std::size_t nbytes = 0;
+  nbytes += sizeof(Real)*(u0.span() + w0.span() + u1.span());
+  nbytes += sizeof(Real)*(coarse_u0.span() + coarse_w0.span());
+  nbytes += sizeof(Real)*(uflx.x1f.span() + uflx.x2f.span() + uflx.x3f.span());
+  nbytes += sizeof(Real)*utest.span();
+  nbytes += sizeof(bool)*fofc.span();
+  nbytes += sizeof(Real)*(u_sts0.span() + dudt_sts0.span());
+  return nbytes;
+}
+
 } // namespace hydro
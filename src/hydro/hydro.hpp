@@ -57,6 +57,19 @@ struct HydroTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID irecv_sts;
+  TaskID flux_sts;
+  TaskID sendf_sts;
+  TaskID recvf_sts;
+  TaskID stsupdt;
+  TaskID restu_sts;
+  TaskID sendu_sts;
+  TaskID recvu_sts;
+  TaskID bcs_sts;
+  TaskID prol_sts;
+  TaskID c2p_sts;
+  TaskID csend_sts;
+  TaskID crecv_sts;
 };
 
 namespace hydro {
@@ -104,10 +117,16 @@ class Hydro {
   bool use_fofc = false;   // flag to enable FOFC
   DvceArray5D<Real> utest;  // scratch array for FOFC
 
+  // following used for super-time-stepping (STS) of viscosity and conduction
+  bool use_sts = false;        // flag to enable operator-split RKL2 STS of diffusion
+  DvceArray5D<Real> u_sts0;    // conserved variables at start of STS (Y_0)
+  DvceArray5D<Real> dudt_sts0; // diffusion operator evaluated at start of STS, L(Y_0)
+
   // container to hold names of TaskIDs
   HydroTaskIDs id;
 
   // functions...
+  std::size_t DeviceMemoryBytes() const;
   void AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
   // ...in "before_stagen_tl" list
   TaskStatus InitRecv(Driver *d, int stage);
@@ -132,6 +151,12 @@ class Hydro {
   // ...in "after_stagen_tl" list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+  // ...in "before_sts", "sts", and "after_sts" lists
+  TaskStatus InitRecvSTS(Driver *d, int stage);
+  TaskStatus FluxesSTS(Driver *d, int stage);
+  TaskStatus STSUpdate(Driver *d, int stage);
+  TaskStatus ClearSendSTS(Driver *d, int stage);
+  TaskStatus ClearRecvSTS(Driver *d, int stage);
 
   // CalculateFluxes function templated over Riemann Solvers
   template <Hydro_RSolver T>
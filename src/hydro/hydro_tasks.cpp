@@ -49,32 +49,85 @@ void Hydro::AssembleHydroTasks(std::map<std::string, std::shared_ptr<TaskList>>
   TaskID none(0);
 
   // assemble "before_stagen" task list
-  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none);
+  id.irecv = tl["before_stagen"]->AddTask(&Hydro::InitRecv, this, none,
+                                          "Hydro::InitRecv");
 
   // assemble "stagen" task list
-  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none);
-  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes,this,id.copyu);
-  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux);
-  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf);
-  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf);
-  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt);
-  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms);
-  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa);
-  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa);
-  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu);
-  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu);
-  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu);
-  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr);
-  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr);
-  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs);
-  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol);
-  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p);
+  id.copyu     = tl["stagen"]->AddTask(&Hydro::CopyCons, this, none,
+                                       "Hydro::CopyCons");
+  id.flux      = tl["stagen"]->AddTask(&Hydro::Fluxes, this, id.copyu,
+                                       "Hydro::Fluxes");
+  id.sendf     = tl["stagen"]->AddTask(&Hydro::SendFlux, this, id.flux,
+                                       "Hydro::SendFlux");
+  id.recvf     = tl["stagen"]->AddTask(&Hydro::RecvFlux, this, id.sendf,
+                                       "Hydro::RecvFlux");
+  id.rkupdt    = tl["stagen"]->AddTask(&Hydro::RKUpdate, this, id.recvf,
+                                       "Hydro::RKUpdate");
+  id.srctrms   = tl["stagen"]->AddTask(&Hydro::HydroSrcTerms, this, id.rkupdt,
+                                       "Hydro::HydroSrcTerms");
+  id.sendu_oa  = tl["stagen"]->AddTask(&Hydro::SendU_OA, this, id.srctrms,
+                                       "Hydro::SendU_OA");
+  id.recvu_oa  = tl["stagen"]->AddTask(&Hydro::RecvU_OA, this, id.sendu_oa,
+                                       "Hydro::RecvU_OA");
+  id.restu     = tl["stagen"]->AddTask(&Hydro::RestrictU, this, id.recvu_oa,
+                                       "Hydro::RestrictU");
+  id.sendu     = tl["stagen"]->AddTask(&Hydro::SendU, this, id.restu,
+                                       "Hydro::SendU");
+  id.recvu     = tl["stagen"]->AddTask(&Hydro::RecvU, this, id.sendu,
+                                       "Hydro::RecvU");
+  id.sendu_shr = tl["stagen"]->AddTask(&Hydro::SendU_Shr, this, id.recvu,
+                                       "Hydro::SendU_Shr");
+  id.recvu_shr = tl["stagen"]->AddTask(&Hydro::RecvU_Shr, this, id.sendu_shr,
+                                       "Hydro::RecvU_Shr");
+  id.bcs       = tl["stagen"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_shr,
+                                       "Hydro::ApplyPhysicalBCs");
+  id.prol      = tl["stagen"]->AddTask(&Hydro::Prolongate, this, id.bcs,
+                                       "Hydro::Prolongate");
+  id.c2p       = tl["stagen"]->AddTask(&Hydro::ConToPrim, this, id.prol,
+                                       "Hydro::ConToPrim");
+  id.newdt     = tl["stagen"]->AddTask(&Hydro::NewTimeStep, this, id.c2p,
+                                       "Hydro::NewTimeStep");
 
   // assemble "after_stagen" task list
-  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none);
+  id.csend = tl["after_stagen"]->AddTask(&Hydro::ClearSend, this, none,
+                                         "Hydro::ClearSend");
   // although RecvFlux/U functions check that all recvs complete, add ClearRecv to
   // task list anyways to catch potential bugs in MPI communication logic
-  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend);
+  id.crecv = tl["after_stagen"]->AddTask(&Hydro::ClearRecv, this, id.csend,
+                                         "Hydro::ClearRecv");
+
+  // assemble "before_sts", "sts", and "after_sts" task lists used for super-time-stepping
+  // of diffusion (only when enabled)
+  if (use_sts) {
+    id.irecv_sts = tl["before_sts"]->AddTask(&Hydro::InitRecvSTS, this, none,
+                                             "Hydro::InitRecvSTS");
+
+    id.flux_sts  = tl["sts"]->AddTask(&Hydro::FluxesSTS, this, none,
+                                      "Hydro::FluxesSTS");
+    id.sendf_sts = tl["sts"]->AddTask(&Hydro::SendFlux, this, id.flux_sts,
+                                      "Hydro::SendFlux");
+    id.recvf_sts = tl["sts"]->AddTask(&Hydro::RecvFlux, this, id.sendf_sts,
+                                      "Hydro::RecvFlux");
+    id.stsupdt   = tl["sts"]->AddTask(&Hydro::STSUpdate, this, id.recvf_sts,
+                                      "Hydro::STSUpdate");
+    id.restu_sts = tl["sts"]->AddTask(&Hydro::RestrictU, this, id.stsupdt,
+                                      "Hydro::RestrictU");
+    id.sendu_sts = tl["sts"]->AddTask(&Hydro::SendU, this, id.restu_sts,
+                                      "Hydro::SendU");
+    id.recvu_sts = tl["sts"]->AddTask(&Hydro::RecvU, this, id.sendu_sts,
+                                      "Hydro::RecvU");
+    id.bcs_sts   = tl["sts"]->AddTask(&Hydro::ApplyPhysicalBCs, this, id.recvu_sts,
+                                      "Hydro::ApplyPhysicalBCs");
+    id.prol_sts  = tl["sts"]->AddTask(&Hydro::Prolongate, this, id.bcs_sts,
+                                      "Hydro::Prolongate");
+    id.c2p_sts   = tl["sts"]->AddTask(&Hydro::ConToPrim, this, id.prol_sts,
+                                      "Hydro::ConToPrim");
+
+    id.csend_sts = tl["after_sts"]->AddTask(&Hydro::ClearSendSTS, this, none,
+                                            "Hydro::ClearSendSTS");
+    id.crecv_sts = tl["after_sts"]->AddTask(&Hydro::ClearRecvSTS, this, id.csend_sts,
+                                            "Hydro::ClearRecvSTS");
+  }
 
   return;
 }
@@ -131,8 +184,9 @@ TaskStatus Hydro::CopyCons(Driver *pdrive, int stage) {
   if (stage == 1) {
     Kokkos::deep_copy(DevExeSpace(), u1, u0);
   } else {
-    if (pdrive->integrator == "rk4") {
-      // parallel loop to update u1 with u0 at later stages, only for rk4
+    if (pdrive->delta[stage-1] != 0.0) {
+      // parallel loop to update u1 with u0 at later stages, only for integrators that
+      // need it (e.g. rk4)
       auto &indcs = pmy_pack->pmesh->mb_indcs;
       int is = indcs.is, ie = indcs.ie;
       int js = indcs.js, je = indcs.je;
@@ -180,12 +234,14 @@ TaskStatus Hydro::Fluxes(Driver *pdrive, int stage) {
     CalculateFluxes<Hydro_RSolver::hlle_gr>(pdrive, stage);
   }
 
-  // Add viscous, heat-flux, etc fluxes
-  if (pvisc != nullptr) {
-    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
-  }
-  if (pcond != nullptr) {
-    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  // Add viscous, heat-flux, etc fluxes (unless they are super-time-stepped)
+  if (!(use_sts)) {
+    if (pvisc != nullptr) {
+      pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+    }
+    if (pcond != nullptr) {
+      pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+    }
   }
 
   // call FOFC if necessary
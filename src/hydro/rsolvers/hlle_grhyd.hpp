@@ -32,6 +32,8 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
   const Real gamma_prime = eos.gamma/(eos.gamma - 1.0);
   auto &flat = coord.is_minkowski;
   auto &spin = coord.bh_spin;
+  auto &cache = coord.cache_metric;
+  auto &gface = (ivx == IVX) ? coord.gx1f : ((ivx == IVY) ? coord.gx2f : coord.gx3f);
 
   int is = indcs.is;
   int js = indcs.js;
@@ -75,7 +77,11 @@ void HLLE_GR(TeamMember_t const &member, const EOS_Data &eos,
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
     Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    if (cache) {
+      LoadMetricAndInverse(gface, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Calculate 4-velocity in left state (contravariant compt)
     Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
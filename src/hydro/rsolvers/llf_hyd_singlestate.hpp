@@ -145,12 +145,13 @@ void SingleStateLLF_SRHyd(const HydPrim1D &wl, const HydPrim1D &wr, const EOS_Da
 
 //----------------------------------------------------------------------------------------
 //! \fn void SingleStateLLF_GRHyd
-//! \brief The LLF Riemann solver for GR hydrodynamics for a single L/R state
+//! \brief The LLF Riemann solver for GR hydrodynamics for a single L/R state, given the
+//! metric and its inverse at the interface
 
 KOKKOS_INLINE_FUNCTION
 void SingleStateLLF_GRHyd(const HydPrim1D wl, const HydPrim1D wr,
-                       const Real x1v, const Real x2v, const Real x3v, const int ivx,
-                       const CoordData &coord, const EOS_Data &eos, HydCons1D &flux) {
+                          const Real glower[][4], const Real gupper[][4], const int ivx,
+                          const EOS_Data &eos, HydCons1D &flux) {
   // Cyclic permutation of array indices
   int ivy = IVX + ((ivx-IVX)+1)%3;
   int ivz = IVX + ((ivx-IVX)+2)%3;
@@ -172,10 +173,6 @@ void SingleStateLLF_GRHyd(const HydPrim1D wl, const HydPrim1D wr,
   wl_ipr = eos.IdealGasPressure(wl.e);
   wr_ipr = eos.IdealGasPressure(wr.e);
 
-  // Extract components of metric
-  Real glower[4][4], gupper[4][4];
-  ComputeMetricAndInverse(x1v,x2v,x3v,coord.is_minkowski, coord.bh_spin, glower, gupper);
-
   // Calculate 4-velocity in left state (contravariant compt)
   Real q = glower[ivx][ivx] * SQR(wl_ivx) + glower[ivy][ivy] * SQR(wl_ivy) +
            glower[ivz][ivz] * SQR(wl_ivz) + 2.0*glower[ivx][ivy] * wl_ivx * wl_ivy +
@@ -286,5 +283,19 @@ void SingleStateLLF_GRHyd(const HydPrim1D wl, const HydPrim1D wr,
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void SingleStateLLF_GRHyd
+//! \brief Overload that evaluates the metric at the interface position (x1v,x2v,x3v)
+
+KOKKOS_INLINE_FUNCTION
+void SingleStateLLF_GRHyd(const HydPrim1D wl, const HydPrim1D wr,
+                       const Real x1v, const Real x2v, const Real x3v, const int ivx,
+                       const CoordData &coord, const EOS_Data &eos, HydCons1D &flux) {
+  Real glower[4][4], gupper[4][4];
+  ComputeMetricAndInverse(x1v,x2v,x3v,coord.is_minkowski, coord.bh_spin, glower, gupper);
+  SingleStateLLF_GRHyd(wl, wr, glower, gupper, ivx, eos, flux);
+  return;
+}
+
 } // namespace hydro
 #endif // HYDRO_RSOLVERS_LLF_HYD_SINGLESTATE_HPP_
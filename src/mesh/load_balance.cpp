@@ -11,6 +11,7 @@
 #include <limits> // numeric_limits<>
 #include <algorithm> // max
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -272,6 +273,7 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
   // Receive requests will only be accessed on host, so no need to sync after this step.
   rb_idx = 0;   // recv buffer index
   bool no_errors=true;
+  std::vector<int> msg_rank(nmb_recv);
   for (int newm=nmbs; newm<=nmbe; newm++) {
     int oldm = newtoold[newm];
     LogicalLocation &old_lloc = pmy_mesh->lloc_eachmb[oldm];
@@ -290,11 +292,15 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
           auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
           // create tag using local ID of *receiving* MeshBlock, post receive
           int tag = CreateAMR_MPI_Tag(newm-nmbs, ox1, ox2, ox3);
-          // post non-blocking receive
-          int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt,
-                     MPI_ATHENA_REAL, pmy_mesh->rank_eachmb[oldm+l], tag, amr_comm,
-                     &(recv_req[rb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
+          // post non-blocking receive (or store sending rank with bulk migration)
+          if (bulk_migration) {
+            msg_rank[rb_idx] = pmy_mesh->rank_eachmb[oldm+l];
+          } else {
+            int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt,
+                       MPI_ATHENA_REAL, pmy_mesh->rank_eachmb[oldm+l], tag, amr_comm,
+                       &(recv_req[rb_idx]));
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+          }
           rb_idx++;
         }
       }
@@ -305,11 +311,15 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
         auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
         // create tag using local ID of *receiving* MeshBlock, post receive
         int tag = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
-        // post non-blocking receive
-        int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
-                   pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
-                   &(recv_req[rb_idx]));
-        if (ierr != MPI_SUCCESS) {no_errors=false;}
+        // post non-blocking receive (or store sending rank with bulk migration)
+        if (bulk_migration) {
+          msg_rank[rb_idx] = pmy_mesh->rank_eachmb[oldm];
+        } else {
+          int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
+                     pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
+                     &(recv_req[rb_idx]));
+          if (ierr != MPI_SUCCESS) {no_errors=false;}
+        }
         rb_idx++;
       }
     } else {                                        // old MB was refined
@@ -321,16 +331,40 @@ void MeshRefinement::InitRecvAMR(int nleaf) {
         auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,ve));
         // create tag using local ID of *receiving* MeshBlock, post receive
         int tag = CreateAMR_MPI_Tag(newm-nmbs, 0, 0, 0);
-        // post non-blocking receive
-        int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
-                   pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
-                   &(recv_req[rb_idx]));
-        if (ierr != MPI_SUCCESS) {no_errors=false;}
+        // post non-blocking receive (or store sending rank with bulk migration)
+        if (bulk_migration) {
+          msg_rank[rb_idx] = pmy_mesh->rank_eachmb[oldm];
+        } else {
+          int ierr = MPI_Irecv(pdata.data(), recvbuf.h_view(rb_idx).cnt, MPI_ATHENA_REAL,
+                     pmy_mesh->rank_eachmb[oldm], tag, amr_comm,
+                     &(recv_req[rb_idx]));
+          if (ierr != MPI_SUCCESS) {no_errors=false;}
+        }
         rb_idx++;
       }
     }
   }
 
+  // With bulk migration, post one receive for each contiguous run of buffers from the
+  // same rank.  Both new and old gids are assigned to ranks in contiguous ranges, so all
+  // buffers from one rank are contiguous in recv_data, and ordered the same way as the
+  // sending rank packs them.  Unused requests remain MPI_REQUEST_NULL.
+  if (bulk_migration) {
+    int nb = 0;
+    while (nb < nmb_recv) {
+      int ne = nb;
+      while ((ne+1 < nmb_recv) && (msg_rank[ne+1] == msg_rank[nb])) {ne++;}
+      int vs = recvbuf.h_view(nb).offset;
+      int cnt = recvbuf.h_view(ne).offset + recvbuf.h_view(ne).cnt - vs;
+      auto pdata = Kokkos::subview(recv_data, std::make_pair(vs,(vs+cnt)));
+      int tag = CreateAMR_MPI_Tag(0, 0, 0, 0);
+      int ierr = MPI_Irecv(pdata.data(), cnt, MPI_ATHENA_REAL, msg_rank[nb], tag,
+                           amr_comm, &(recv_req[nb]));
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      nb = ne + 1;
+    }
+  }
+
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -525,30 +559,35 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
   }
 
   // Step 3. (PackAndSendAMR)
-  // Pack data into send buffers in parallel
-  hydro::Hydro* phydro = pmy_mesh->pmb_pack->phydro;
-  mhd::MHD* pmhd = pmy_mesh->pmb_pack->pmhd;
-  radiation::Radiation* prad = pmy_mesh->pmb_pack->prad;
-  z4c::Z4c* pz4c = pmy_mesh->pmb_pack->pz4c;
+  // Pack data into send buffers in parallel.  With bulk migration, all variables of all
+  // MBs are packed with a single kernel.
+  if (bulk_migration) {
+    CopyAMRBuffersBulk(true);
+  } else {
+    hydro::Hydro* phydro = pmy_mesh->pmb_pack->phydro;
+    mhd::MHD* pmhd = pmy_mesh->pmb_pack->pmhd;
+    radiation::Radiation* prad = pmy_mesh->pmb_pack->prad;
+    z4c::Z4c* pz4c = pmy_mesh->pmb_pack->pz4c;
 
-  int ncc_sent = 0, nfc_sent = 0;
-  if (phydro != nullptr) {
-    PackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_sent, nfc_sent);
-    ncc_sent += phydro->nhydro + phydro->nscalars;
-  }
-  if (pmhd != nullptr) {
-    PackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_sent, nfc_sent);
-    ncc_sent += pmhd->nmhd + pmhd->nscalars;
-    PackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_sent, nfc_sent);
-    nfc_sent += 1;
-  }
-  if (prad != nullptr) {
-    PackAMRBuffersCC(prad->i0, prad->coarse_i0, ncc_sent, nfc_sent);
-    ncc_sent += prad->prgeo->nangles;
-  }
-  if (pz4c != nullptr) {
-    PackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_sent, nfc_sent);
-    ncc_sent += pz4c->nz4c;
+    int ncc_sent = 0, nfc_sent = 0;
+    if (phydro != nullptr) {
+      PackAMRBuffersCC(phydro->u0, phydro->coarse_u0, ncc_sent, nfc_sent);
+      ncc_sent += phydro->nhydro + phydro->nscalars;
+    }
+    if (pmhd != nullptr) {
+      PackAMRBuffersCC(pmhd->u0, pmhd->coarse_u0, ncc_sent, nfc_sent);
+      ncc_sent += pmhd->nmhd + pmhd->nscalars;
+      PackAMRBuffersFC(pmhd->b0, pmhd->coarse_b0, ncc_sent, nfc_sent);
+      nfc_sent += 1;
+    }
+    if (prad != nullptr) {
+      PackAMRBuffersCC(prad->i0, prad->coarse_i0, ncc_sent, nfc_sent);
+      ncc_sent += prad->prgeo->nangles;
+    }
+    if (pz4c != nullptr) {
+      PackAMRBuffersCC(pz4c->u0, pz4c->coarse_u0, ncc_sent, nfc_sent);
+      ncc_sent += pz4c->nz4c;
+    }
   }
 
   // Step 4. (PackAndSendAMR)
@@ -557,6 +596,7 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
   Kokkos::fence();
   bool no_errors=true;
   sb_idx = 0;     // send buffer index
+  std::vector<int> msg_rank(nmb_send);
   for (int oldm=ombs; oldm<=ombe; oldm++) {
     int newm = oldtonew[oldm];
     LogicalLocation &old_lloc = pmy_mesh->lloc_eachmb[oldm];
@@ -572,11 +612,15 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
           // create tag using local ID of *receiving* MeshBlock
           int lid = (newm + l) - new_gids_eachrank[new_rank_eachmb[newm+l]];
           int tag = CreateAMR_MPI_Tag(lid, 0, 0, 0);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm+l], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
+          // post non-blocking send (or store receiving rank with bulk migration)
+          if (bulk_migration) {
+            msg_rank[sb_idx] = new_rank_eachmb[newm+l];
+          } else {
+            int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt,
+                       MPI_ATHENA_REAL, new_rank_eachmb[newm+l], tag, amr_comm,
+                       &(send_req[sb_idx]));
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+          }
           sb_idx++;
         }
       }
@@ -589,11 +633,15 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
           // create tag using local ID of *receiving* MeshBlock
           int lid = newm - new_gids_eachrank[new_rank_eachmb[newm]];
           int tag = CreateAMR_MPI_Tag(lid, 0, 0, 0);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
+          // post non-blocking send (or store receiving rank with bulk migration)
+          if (bulk_migration) {
+            msg_rank[sb_idx] = new_rank_eachmb[newm];
+          } else {
+            int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt,
+                       MPI_ATHENA_REAL, new_rank_eachmb[newm], tag, amr_comm,
+                       &(send_req[sb_idx]));
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+          }
           sb_idx++;
         }
       } else {                                  // old MB was de-refined
@@ -609,17 +657,39 @@ void MeshRefinement::PackAndSendAMR(int nleaf) {
           int ox3 = ((old_lloc.lx3 & 1) == 1);
           int lid = newm - new_gids_eachrank[new_rank_eachmb[newm]];
           int tag = CreateAMR_MPI_Tag(lid, ox1, ox2, ox3);
-          // post non-blocking send
-          int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt, MPI_ATHENA_REAL,
-                     new_rank_eachmb[newm], tag, amr_comm,
-                     &(send_req[sb_idx]));
-          if (ierr != MPI_SUCCESS) {no_errors=false;}
+          // post non-blocking send (or store receiving rank with bulk migration)
+          if (bulk_migration) {
+            msg_rank[sb_idx] = new_rank_eachmb[newm];
+          } else {
+            int ierr = MPI_Isend(pdata.data(), sendbuf.h_view(sb_idx).cnt,
+                       MPI_ATHENA_REAL, new_rank_eachmb[newm], tag, amr_comm,
+                       &(send_req[sb_idx]));
+            if (ierr != MPI_SUCCESS) {no_errors=false;}
+          }
           sb_idx++;
         }
       }
     }
   }
 
+  // With bulk migration, post one send for each contiguous run of buffers to the same
+  // rank (see InitRecvAMR).  Unused requests remain MPI_REQUEST_NULL.
+  if (bulk_migration) {
+    int nb = 0;
+    while (nb < nmb_send) {
+      int ne = nb;
+      while ((ne+1 < nmb_send) && (msg_rank[ne+1] == msg_rank[nb])) {ne++;}
+      int vs = sendbuf.h_view(nb).offset;
+      int cnt = sendbuf.h_view(ne).offset + sendbuf.h_view(ne).cnt - vs;
+      auto pdata = Kokkos::subview(send_data, std::make_pair(vs,(vs+cnt)));
+      int tag = CreateAMR_MPI_Tag(0, 0, 0, 0);
+      int ierr = MPI_Isend(pdata.data(), cnt, MPI_ATHENA_REAL, msg_rank[nb], tag,
+                           amr_comm, &(send_req[nb]));
+      if (ierr != MPI_SUCCESS) {no_errors=false;}
+      nb = ne + 1;
+    }
+  }
+
   // Quit if MPI error detected
   if (!(no_errors)) {
     std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
@@ -814,7 +884,11 @@ void MeshRefinement::ClearRecvAndUnpackAMR() {
   }
   delete [] recv_req;
 
-  // Unpack data
+  // Unpack data (with a single kernel for all variables with bulk migration)
+  if (bulk_migration) {
+    CopyAMRBuffersBulk(false);
+    return;
+  }
   hydro::Hydro* phydro = pmy_mesh->pmb_pack->phydro;
   mhd::MHD* pmhd = pmy_mesh->pmb_pack->pmhd;
   radiation::Radiation* prad = pmy_mesh->pmb_pack->prad;
@@ -1006,6 +1080,104 @@ void MeshRefinement::UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b, DvceFaceFld4D<Re
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void MeshRefinement::CopyAMRBuffersBulk()
+//! \brief Packs (pack=true) all CC and FC data of all MBs being sent into send_data, or
+//! unpacks (pack=false) all data of all MBs received from recv_data, with a single kernel
+//! used with bulk migration.  Each team copies the contiguous payload of one MB, with the
+//! same layout as PackAMRBuffersCC/FC(): hydro, MHD CC, MHD FC, radiation, then Z4c.
+
+void MeshRefinement::CopyAMRBuffersBulk(bool pack) {
+#if MPI_PARALLEL_ENABLED
+  auto &buf = (pack)? sendbuf : recvbuf;
+  auto &bdata = (pack)? send_data : recv_data;
+  int nbuf = (pack)? nmb_send : nmb_recv;
+
+  // evolved variables of each physics, number of variables is zero if physics not used
+  MeshBlockPack *pmbp = pmy_mesh->pmb_pack;
+  DvceArray5D<Real> uh, cuh, um, cum, ir, cir, uz, cuz;
+  DvceArray4D<Real> b1, b2, b3, cb1, cb2, cb3;
+  int nh = 0, nm = 0, nb = 0, nr = 0, nz = 0;
+  if (pmbp->phydro != nullptr) {
+    uh = pmbp->phydro->u0;  cuh = pmbp->phydro->coarse_u0;
+    nh = pmbp->phydro->nhydro + pmbp->phydro->nscalars;
+  }
+  if (pmbp->pmhd != nullptr) {
+    um = pmbp->pmhd->u0;  cum = pmbp->pmhd->coarse_u0;
+    nm = pmbp->pmhd->nmhd + pmbp->pmhd->nscalars;
+    b1 = pmbp->pmhd->b0.x1f;  cb1 = pmbp->pmhd->coarse_b0.x1f;
+    b2 = pmbp->pmhd->b0.x2f;  cb2 = pmbp->pmhd->coarse_b0.x2f;
+    b3 = pmbp->pmhd->b0.x3f;  cb3 = pmbp->pmhd->coarse_b0.x3f;
+    nb = 1;
+  }
+  if (pmbp->prad != nullptr) {
+    ir = pmbp->prad->i0;  cir = pmbp->prad->coarse_i0;
+    nr = pmbp->prad->prgeo->nangles;
+  }
+  if (pmbp->pz4c != nullptr) {
+    uz = pmbp->pz4c->u0;  cuz = pmbp->pz4c->coarse_u0;
+    nz = pmbp->pz4c->nz4c;
+  }
+
+  // Outer loop over # of MeshBlocks sent/received
+  Kokkos::TeamPolicy<> policy(DevExeSpace(), nbuf, Kokkos::AUTO);
+  Kokkos::parallel_for("BulkBuff", policy, KOKKOS_LAMBDA(TeamMember_t tmember) {
+    const int n = tmember.league_rank();
+    const int il = buf.d_view(n).bis;
+    const int jl = buf.d_view(n).bjs;
+    const int kl = buf.d_view(n).bks;
+    const int nicc = buf.d_view(n).bie - il + 1;
+    const int njcc = buf.d_view(n).bje - jl + 1;
+    const int nkcc = buf.d_view(n).bke - kl + 1;
+    const int cntcc = buf.d_view(n).cntcc;
+    const int m = buf.d_view(n).lid;
+    const int offset = buf.d_view(n).offset;
+    const bool crs = buf.d_view(n).use_coarse;
+
+    // Inner loop over all elements of buffer
+    Kokkos::parallel_for(Kokkos::TeamThreadRange<>(tmember, buf.d_view(n).cnt),
+    [&](const int idx) {
+      // find array (0-6 = hydro, MHD CC, b.x1f, b.x2f, b.x3f, rad, Z4c) and offset q
+      int q = idx, iarr = 0;
+      if (q >= nh*cntcc) {q -= nh*cntcc; iarr = 1;}
+      if (iarr == 1 && q >= nm*cntcc) {q -= nm*cntcc; iarr = 2;}
+      if (iarr == 2 && q >= nb*(nicc+1)*njcc*nkcc) {q -= nb*(nicc+1)*njcc*nkcc; iarr = 3;}
+      if (iarr == 3 && q >= nb*nicc*(njcc+1)*nkcc) {q -= nb*nicc*(njcc+1)*nkcc; iarr = 4;}
+      if (iarr == 4 && q >= nb*nicc*njcc*(nkcc+1)) {q -= nb*nicc*njcc*(nkcc+1); iarr = 5;}
+      if (iarr == 5 && q >= nr*cntcc) {q -= nr*cntcc; iarr = 6;}
+      int v = 0;
+      if (iarr < 2 || iarr > 4) {
+        v = q/cntcc;
+        q -= v*cntcc;
+      }
+      const int ni = (iarr == 2)? nicc + 1 : nicc;  // add b.x1f at (ie+1)
+      const int nj = (iarr == 3)? njcc + 1 : njcc;  // add b.x2f at (je+1)
+      const int nji = nj*ni;
+      const int k = q/nji + kl;
+      const int j = (q - (k-kl)*nji)/ni + jl;
+      const int i = q - (k-kl)*nji - (j-jl)*ni + il;
+
+      Real *pval;
+      switch (iarr) {
+        case 0: pval = (crs)? &cuh(m,v,k,j,i) : &uh(m,v,k,j,i); break;
+        case 1: pval = (crs)? &cum(m,v,k,j,i) : &um(m,v,k,j,i); break;
+        case 2: pval = (crs)? &cb1(m,k,j,i) : &b1(m,k,j,i); break;
+        case 3: pval = (crs)? &cb2(m,k,j,i) : &b2(m,k,j,i); break;
+        case 4: pval = (crs)? &cb3(m,k,j,i) : &b3(m,k,j,i); break;
+        case 5: pval = (crs)? &cir(m,v,k,j,i) : &ir(m,v,k,j,i); break;
+        default: pval = (crs)? &cuz(m,v,k,j,i) : &uz(m,v,k,j,i); break;
+      }
+      if (pack) {
+        bdata(offset + idx) = *pval;
+      } else {
+        *pval = bdata(offset + idx);
+      }
+    });
+  }); // end par_for_outer
+#endif
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void MeshRefinement::ClearSendAMR()
 //! \brief Checks all non-blocking sends completed, deletes send buffers.
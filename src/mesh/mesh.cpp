@@ -565,72 +565,117 @@ std::string Mesh::GetBoundaryString(BoundaryFlag input_flag) {
 
 //----------------------------------------------------------------------------------------
 // \fn Mesh::NewTimeStep()
+//! \brief computes new timestep, blocking until the global minimum is known
 
 void Mesh::NewTimeStep(const Real tlim) {
-  // save old timestep
-  dtold = dt;
-  if (dt == std::numeric_limits<float>::max()) {
-    dtold = 0.;
-  }
+  StartNewTimeStep();
+  FinishNewTimeStep(tlim);
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::StartNewTimeStep()
+//! \brief finds minimum timestep on this rank and starts (non-blocking) global minimum.
+//! Mesh::dt is left unchanged until FinishNewTimeStep() is called, so work that needs
+//! the current dt (e.g. outputs) can overlap the reduction.  If a reduction is already
+//! in flight (e.g. when the mesh was regridded after it started), it is completed and
+//! its result discarded.
+
+void Mesh::StartNewTimeStep() {
+#if MPI_PARALLEL_ENABLED
+  if (dt_pending_) {MPI_Wait(&dt_req_, MPI_STATUS_IGNORE);}
+#endif
+  dt_pending_ = true;
 
   // cycle over all MeshBlocks on this rank and find minimum dt
   // Requires at least ONE of the physics modules to be defined.
   // limit increase in timestep to 2x old value
-  dt = 2.0*dt;
+  dtnew_[0] = 2.0*dt;
+  // With super-time-stepping (STS) the viscous and conduction timesteps do not limit dt,
+  // but their minimum (dtnew_[1]) sets the number of STS stages used each cycle.
+  dtnew_[1] = std::numeric_limits<float>::max();
 
   // Hydro timestep
   if (pmb_pack->phydro != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->dtnew) );
+    Real &dtpara = (pmb_pack->phydro->use_sts)? dtnew_[1] : dtnew_[0];
+    dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->phydro->dtnew) );
     // viscosity timestep
     if (pmb_pack->phydro->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
+      dtpara = std::min(dtpara, (cfl_no)*(pmb_pack->phydro->pvisc->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->phydro->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
+      dtpara = std::min(dtpara, (cfl_no)*(pmb_pack->phydro->pcond->dtnew) );
     }
     // source terms timestep
     if (pmb_pack->phydro->psrc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
+      dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->phydro->psrc->dtnew) );
     }
   }
   // MHD timestep
   if (pmb_pack->pmhd != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->dtnew) );
+    Real &dtpara = (pmb_pack->pmhd->use_sts)? dtnew_[1] : dtnew_[0];
+    dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->pmhd->dtnew) );
     // viscosity timestep
     if (pmb_pack->pmhd->pvisc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
+      dtpara = std::min(dtpara, (cfl_no)*(pmb_pack->pmhd->pvisc->dtnew) );
     }
-    // resistivity timestep
+    // resistivity timestep (always explicit, as resistivity also evolves B via CT)
     if (pmb_pack->pmhd->presist != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
+      dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->pmhd->presist->dtnew) );
     }
     // thermal conduction timestep
     if (pmb_pack->pmhd->pcond != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
+      dtpara = std::min(dtpara, (cfl_no)*(pmb_pack->pmhd->pcond->dtnew) );
     }
     // source terms timestep
     if (pmb_pack->pmhd->psrc != nullptr) {
-      dt = std::min(dt, (cfl_no)*(pmb_pack->pmhd->psrc->dtnew) );
+      dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->pmhd->psrc->dtnew) );
     }
   }
   // z4c timestep
   if (pmb_pack->pz4c != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->pz4c->dtnew) );
+    dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->pz4c->dtnew) );
   }
   // Radiation timestep
   if (pmb_pack->prad != nullptr) {
-    dt = std::min(dt, (cfl_no)*(pmb_pack->prad->dtnew) );
+    dtnew_[0] = std::min(dtnew_[0], (cfl_no)*(pmb_pack->prad->dtnew) );
   }
   // Particles timestep
   if (pmb_pack->ppart != nullptr) {
-    dt = std::min(dt, (pmb_pack->ppart->dtnew) );
+    dtnew_[0] = std::min(dtnew_[0], (pmb_pack->ppart->dtnew) );
   }
 
 #if MPI_PARALLEL_ENABLED
-  // get minimum dt over all MPI ranks
-  MPI_Allreduce(MPI_IN_PLACE, &dt, 1, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD);
+  // start minimum of both timesteps over all MPI ranks
+  MPI_Iallreduce(MPI_IN_PLACE, dtnew_, 2, MPI_ATHENA_REAL, MPI_MIN, MPI_COMM_WORLD,
+                 &dt_req_);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+// \fn Mesh::FinishNewTimeStep()
+//! \brief completes global minimum started in StartNewTimeStep() and sets new dt.  Does
+//! nothing if no reduction is in flight, so it can be called before every use of dt.
+
+void Mesh::FinishNewTimeStep(const Real tlim) {
+  if (!(dt_pending_)) {return;}
+#if MPI_PARALLEL_ENABLED
+  MPI_Wait(&dt_req_, MPI_STATUS_IGNORE);
 #endif
+  dt_pending_ = false;
+
+  // save old timestep
+  dtold = dt;
+  if (dt == std::numeric_limits<float>::max()) {
+    dtold = 0.;
+  }
+  dt = dtnew_[0];
+
+  // with super-time-stepping, optionally limit dt to a multiple of the diffusive dt
+  dt_diff = dtnew_[1];
+  if (sts_max_dt_ratio > 0.0) {dt = std::min(dt, sts_max_dt_ratio*dt_diff);}
 
   // limit last time step to stop at tlim *exactly*
   if ( (time < tlim) && ((time + dt) > tlim) ) {dt = tlim - time;}
@@ -675,4 +720,26 @@ void Mesh::AddCoordinatesAndPhysics(ParameterInput *pinput) {
   if (adaptive) {
     pmr->pmrc = new RefinementCriteria(this, pinput);
   }
+
+  if (global_variable::my_rank == 0) {PrintMemoryDiagnostics();}
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Mesh::PrintMemoryDiagnostics()
+//  \brief prints device memory used by the main arrays in each fluid module on rank 0,
+//  normalized by the number of active cells that can be stored on this rank.  Called at
+//  the end of AddCoordinatesAndPhysics.
+
+void Mesh::PrintMemoryDiagnostics() {
+  if (pmb_pack->phydro == nullptr && pmb_pack->pmhd == nullptr) {return;}
+  int nmb = std::max((pmb_pack->nmb_thispack), nmb_maxperrank);
+  Real ncells = static_cast<Real>(nmb)*static_cast<Real>(NumberOfMeshBlockCells());
+  std::cout << std::endl << "Device memory per cell (bytes, rank 0):" << std::endl;
+  if (pmb_pack->phydro != nullptr) {
+    std::cout << "  hydro = " << pmb_pack->phydro->DeviceMemoryBytes()/ncells
+              << std::endl;
+  }
+  if (pmb_pack->pmhd != nullptr) {
+    std::cout << "  mhd   = " << pmb_pack->pmhd->DeviceMemoryBytes()/ncells << std::endl;
+  }
 }
@@ -138,6 +138,8 @@ class Mesh {
   int *nprtcl_eachrank;    // number of particles on each rank
 
   Real time, dt, dtold, cfl_no;
+  Real dt_diff;           // diffusive timestep (only with super-time-stepping)
+  Real sts_max_dt_ratio;  // max ratio dt/dt_diff with super-time-stepping (<0: none)
   int ncycle;
   EventCounters ecounter;
 
@@ -151,8 +153,11 @@ class Mesh {
   void BuildTreeFromRestart(ParameterInput *pin, IOWrapper &resfile,
                             bool single_file_per_rank=false);
   void PrintMeshDiagnostics();
+  void PrintMemoryDiagnostics();
   void WriteMeshStructure();
   void NewTimeStep(const Real tlim);
+  void StartNewTimeStep();
+  void FinishNewTimeStep(const Real tlim);
   void AddCoordinatesAndPhysics(ParameterInput *pinput);
   BoundaryFlag GetBoundaryFlag(const std::string& input_string);
   std::string GetBoundaryString(BoundaryFlag input_flag);
@@ -175,6 +180,11 @@ class Mesh {
 
  private:
   std::unique_ptr<MeshBlockTree> ptree;  // pointer to root node in binary/quad/oct-tree
+  Real dtnew_[2];        // new (hyperbolic, diffusive) dt while global minimum in flight
+  bool dt_pending_ = false;  // true between StartNewTimeStep() and FinishNewTimeStep()
+#if MPI_PARALLEL_ENABLED
+  MPI_Request dt_req_ = MPI_REQUEST_NULL;  // request for non-blocking minimum of dt
+#endif
   void LoadBalance(float *clist, int *rlist, int *slist, int *nlist, int nb);
 };
 #endif  // MESH_MESH_HPP_
@@ -28,6 +28,7 @@
 #include "coordinates/adm.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "particles/particles.hpp"
 #include "prolongation.hpp"
 #include "restriction.hpp"
 
@@ -43,22 +44,31 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   pmy_mesh(pm),
   refine_flag("rflag",pm->nmb_total),
   ncyc_since_ref("cyc_since_ref",pm->nmb_total),
+  nderef_check("nderef_check",pm->nmb_total),
   nmb_created(0),
   nmb_deleted(0),
   nmb_sent_thisrank(0),
   ncyc_check_amr(1),
   refinement_interval(5),
+  derefine_count(1),
+  nregrid(0),
+  regrid_time(0.0),
 #if MPI_PARALLEL_ENABLED
   sendbuf("lb send buff",1),
   recvbuf("lb recv buff",1),
   send_data("lb send data",1),
   recv_data("lb recv data",1),
 #endif
-  prolong_prims(false) {
+  prolong_prims(false),
+  bulk_migration(false) {
   if (pin->DoesBlockExist("mesh_refinement")) {
     // read interval (in cycles) between check of AMR and derefinement
     ncyc_check_amr = pin->GetOrAddReal("mesh_refinement", "ncycle_check", 1);
     refinement_interval = pin->GetOrAddReal("mesh_refinement", "refinement_interval", 5);
+    // read number of successive checks a MB must be flagged before it is derefined
+    derefine_count = pin->GetOrAddInteger("mesh_refinement", "derefine_count", 1);
+    // aggregate MeshBlocks migrating to the same rank into one message
+    bulk_migration = pin->GetOrAddBoolean("mesh_refinement", "bulk_migration", false);
     // read prolongate primitives flag
     if (pin->DoesParameterExist("mesh_refinement", "prolong_primitives")) {
       prolong_prims = pin->GetBoolean("mesh_refinement", "prolong_primitives");
@@ -78,10 +88,15 @@ MeshRefinement::MeshRefinement(Mesh *pm, ParameterInput *pin) :
   // be sure Views are initialized to zero
   for (int m=0; m<(pm->nmb_total); ++m) {
     refine_flag.h_view(m) = 0;
-    ncyc_since_ref(m) = 0;
+    ncyc_since_ref.h_view(m) = 0;
+    nderef_check.h_view(m) = 0;
   }
   refine_flag.template modify<HostMemSpace>();
   refine_flag.template sync<DevExeSpace>();
+  ncyc_since_ref.template modify<HostMemSpace>();
+  ncyc_since_ref.template sync<DevExeSpace>();
+  nderef_check.template modify<HostMemSpace>();
+  nderef_check.template sync<DevExeSpace>();
 
   // initialize interpolation weights for prolongation and restriction
   InitInterpWghts();
@@ -119,10 +134,14 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
 
   // Refine/derefine mesh and evolved data, set boundary conditions/timestep on new mesh
   if (nnew != 0 || ndel != 0) { // at least one (de)refinement flagged
+    Kokkos::Timer regrid_timer;
     RedistAndRefineMeshBlocks(pin, nnew, ndel);
     pdriver->InitBoundaryValuesAndPrimitives(pmy_mesh);
 
+    // ghost zones and primitives are only kept in unchanged MBs for the reset above
     MeshBlockPack* pmbp = pmy_mesh->pmb_pack;
+    Kokkos::deep_copy(pmbp->pmb->mb_unchanged.h_view, false);
+    Kokkos::deep_copy(pmbp->pmb->mb_unchanged.d_view, false);
     if (pmbp->phydro != nullptr) {
       (void) pmbp->phydro->NewTimeStep(pdriver, pdriver->nexp_stages);
     }
@@ -138,6 +157,9 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
 
     nmb_created += nnew;
     nmb_deleted += ndel;
+    Kokkos::fence();
+    regrid_time += regrid_timer.seconds();
+    nregrid++;
   }
   return;
 }
@@ -146,21 +168,26 @@ void MeshRefinement::AdaptiveMeshRefinement(Driver *pdriver, ParameterInput *pin
 //! \fn void RefinementCriteria::CheckForRefinement()
 //! \brief Checks for refinement/de-refinement and sets refine_flag(m) for all
 //! MeshBlocks within a MeshBlockPack.  Increments number of cycles since last refinement
-//! counter for all MeshBlocks
+//! counter for all MeshBlocks.  Flags and counters are persistent and updated on the
+//! device; only flags of MeshBlocks on this rank are set.  Flags of MBs on other ranks
+//! are not needed: UpdateMeshBlockTree exchanges LogicalLocations of flagged MBs only,
+//! and RedistAndRefineMeshBlocks resets refine_flag for all MBs from the updated tree.
 
 void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
-  // reallocate and zero refine_flag in host space and sync with device
-  Kokkos::realloc(refine_flag, pmy_mesh->nmb_total);
-  for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
-    refine_flag.h_view(m) = 0;
+  // zero refine_flag on device and host. Only reallocate if number of MBs has changed.
+  int nmb_total = pmy_mesh->nmb_total;
+  if (refine_flag.extent_int(0) != nmb_total) {
+    Kokkos::realloc(refine_flag, nmb_total);
   }
-  refine_flag.template modify<HostMemSpace>();
-  refine_flag.template sync<DevExeSpace>();
+  Kokkos::deep_copy(refine_flag.d_view, 0);
+  Kokkos::deep_copy(refine_flag.h_view, 0);
 
-  // increment cycle counter for each MB
-  for (int m=0; m<(pmy_mesh->nmb_total); ++m) {
-    ncyc_since_ref(m) += 1;
-  }
+  // increment cycle counter for each MB (on device)
+  auto &ncyc = ncyc_since_ref;
+  par_for("ncyc_since_ref", DevExeSpace(), 0, (nmb_total-1), KOKKOS_LAMBDA(int m) {
+    ncyc.d_view(m) += 1;
+  });
+  ncyc_since_ref.template modify<DevExeSpace>();
   if ((pmy_mesh->ncycle)%(ncyc_check_amr) != 0) {return;}  // not cycle to check
 
   // calculate derived refinement variables
@@ -168,18 +195,17 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
     pmrc->SetRefinementData(pmbp, false, true);
   }
 
-  // iterate through list of refinement criteria and apply methods
+  // evaluate all criteria based on data within MBs in a single fused kernel
+  pmrc->CheckFused(pmbp);
+
+  // iterate through list of remaining refinement criteria and apply methods
   for (auto it = pmrc->rcrit.begin(); it != pmrc->rcrit.end(); ++it) {
     switch (it->rmethod) {
       case RefCritMethod::min_max:
-        pmrc->CheckMinMax(pmbp, *it);
-        break;
       case RefCritMethod::slope:
-        pmrc->CheckSlope(pmbp, *it);
-        break;
       case RefCritMethod::second_deriv:
-        pmrc->CheckSecondDeriv(pmbp, *it);
-        break;
+      case RefCritMethod::lohner:
+        break;  // already evaluated in CheckFused()
       case RefCritMethod::location:
         pmrc->CheckLocation(pmbp, *it);
         break;
@@ -193,31 +219,37 @@ void MeshRefinement::CheckForRefinement(MeshBlockPack* pmbp) {
     }
   }
 
-  // Turn off (on host) refine/derefine flag for MeshBlocks at max/root level
+  // Turn off (on device) refine/derefine flag for MeshBlocks at max/root level, and for
+  // any MB that has been recently refined.  Only allow derefinement once MB has been
+  // flagged for derefinement in derefine_count successive checks (hysteresis).
   int nmb = pmbp->nmb_thispack;
   int mbs = pmy_mesh->gids_eachrank[global_variable::my_rank];
-  for (int m=0; m<nmb; ++m) {
-    if (pmy_mesh->lloc_eachmb[m+mbs].level == pmy_mesh->max_level) {
-      if (refine_flag.h_view(m+mbs) > 0) {refine_flag.h_view(m+mbs) = 0;}
-    }
-    if (pmy_mesh->lloc_eachmb[m+mbs].level == pmy_mesh->root_level) {
-      if (refine_flag.h_view(m+mbs) < 0) {refine_flag.h_view(m+mbs) = 0;}
+  int max_level = pmy_mesh->max_level;
+  int root_level = pmy_mesh->root_level;
+  int ref_interval = refinement_interval;
+  int nderef_min = derefine_count;
+  auto &mblev = pmbp->pmb->mb_lev;
+  auto &rflag = refine_flag;
+  auto &nderef = nderef_check;
+  refine_flag.template sync<DevExeSpace>();
+  nderef_check.template sync<DevExeSpace>();
+  par_for("rflag_mask", DevExeSpace(), 0, (nmb-1), KOKKOS_LAMBDA(int m) {
+    int &flag = rflag.d_view(m+mbs);
+    if (mblev.d_view(m) == max_level && flag > 0) {flag = 0;}
+    if (mblev.d_view(m) == root_level && flag < 0) {flag = 0;}
+    if (ncyc.d_view(m+mbs) < ref_interval) {flag = 0;}
+    if (flag < 0) {
+      nderef.d_view(m+mbs) += 1;
+      if (nderef.d_view(m+mbs) < nderef_min) {flag = 0;}
+    } else {
+      nderef.d_view(m+mbs) = 0;
     }
-  }
-  // Turn off (on host) refine/derefine flag for any MB that has been recently refined
-  for (int m=0; m<nmb; ++m) {
-    if (ncyc_since_ref(m+mbs) < refinement_interval) {refine_flag.h_view(m+mbs) = 0;}
-  }
+  });
+  nderef_check.template modify<DevExeSpace>();
 
-#if MPI_PARALLEL_ENABLED
-  // Pass (host) refine_flag between all ranks
-    MPI_Allgatherv(MPI_IN_PLACE, pmy_mesh->nmb_eachrank[global_variable::my_rank],
-                   MPI_INT, refine_flag.h_view.data(), pmy_mesh->nmb_eachrank,
-                   pmy_mesh->gids_eachrank, MPI_INT, MPI_COMM_WORLD);
-#endif
-  // sync host array with device
-  refine_flag.template modify<HostMemSpace>();
-  refine_flag.template sync<DevExeSpace>();
+  // sync device array with host (UpdateMeshBlockTree counts flags on host)
+  refine_flag.template modify<DevExeSpace>();
+  refine_flag.template sync<HostMemSpace>();
   return;
 }
 
@@ -504,13 +536,17 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
 
   // Step 6.
   // Copy evolved physics variables to new MB index within View for MeshBlocks that stay
-  // within this rank
+  // within this rank.  Primitives are copied too, so they need not be recomputed in MBs
+  // that do not change (see mb_unchanged below).
   if (phydro != nullptr) {
     CopyCC(phydro->u0);
+    CopyCC(phydro->w0);
   }
   if (pmhd != nullptr) {
     CopyCC(pmhd->u0);
     CopyFC(pmhd->b0);
+    CopyCC(pmhd->w0);
+    CopyCC(pmhd->bcc0);
   }
   if (prad != nullptr) {
     CopyCC(prad->i0);
@@ -577,17 +613,90 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   // Step 10.
   // General housekeeping
   // Update new number of cycles since refinement
+  ncyc_since_ref.template sync<HostMemSpace>();
   HostArray1D<int> new_ncyc_since_ref("nnref",new_nmb_total);
   for (int m=0; m<(new_nmb_total); ++m) {
     int oldm = newtoold[m];
     if (refine_flag.h_view(oldm) != 0) {
       new_ncyc_since_ref(m) = 0;
     } else {
-      new_ncyc_since_ref(m) = ncyc_since_ref(oldm);
+      new_ncyc_since_ref(m) = ncyc_since_ref.h_view(oldm);
     }
   }
   Kokkos::realloc(ncyc_since_ref, new_nmb_total);
-  Kokkos::deep_copy(ncyc_since_ref, new_ncyc_since_ref);
+  Kokkos::deep_copy(ncyc_since_ref.h_view, new_ncyc_since_ref);
+  ncyc_since_ref.template modify<HostMemSpace>();
+  ncyc_since_ref.template sync<DevExeSpace>();
+
+  // Update number of successive derefinement checks.  Counters are only updated on the
+  // rank that owns each MB, so reset them for MBs that change rank.
+  nderef_check.template sync<HostMemSpace>();
+  HostArray1D<int> new_nderef_check("nnderef",new_nmb_total);
+  for (int m=0; m<(new_nmb_total); ++m) {
+    int oldm = newtoold[m];
+    if ((refine_flag.h_view(oldm) != 0) ||
+        (pm->rank_eachmb[oldm] != new_rank_eachmb[m])) {
+      new_nderef_check(m) = 0;
+    } else {
+      new_nderef_check(m) = nderef_check.h_view(oldm);
+    }
+  }
+  Kokkos::realloc(nderef_check, new_nmb_total);
+  Kokkos::deep_copy(nderef_check.h_view, new_nderef_check);
+  nderef_check.template modify<HostMemSpace>();
+  nderef_check.template sync<DevExeSpace>();
+
+  // For each new MB on this rank, store index of same MB in old MeshBlockPack if it was
+  // neither refined nor derefined and was already on this rank, otherwise -1.  Geometric
+  // data (excision masks, cached metric) of such MBs is copied rather than recomputed.
+  int nmb_new_thisrank = new_nmb_eachrank[global_variable::my_rank];
+  int *old_mbidx = new int[nmb_new_thisrank];
+  for (int m=0; m<nmb_new_thisrank; ++m) {
+    int newm = new_gids_eachrank[global_variable::my_rank] + m;
+    int oldm = newtoold[newm];
+    if ((refine_flag.h_view(oldm) == 0) &&
+        (pm->rank_eachmb[oldm] == global_variable::my_rank)) {
+      old_mbidx[m] = oldm - pm->gids_eachrank[global_variable::my_rank];
+    } else {
+      old_mbidx[m] = -1;
+    }
+  }
+
+  // Particles move with their MeshBlock.  Set gid of new MB containing each particle on
+  // this rank (the child containing its position if the old MB was refined), while
+  // sizes of old MBs are still available.  Particles are sent to new ranks below.
+  particles::Particles *ppart = pm->pmb_pack->ppart;
+  HostArray2D<Real> prdata;
+  HostArray2D<int>  pidata;
+  if (ppart != nullptr) {
+    int npart = ppart->nprtcl_thispack;
+    auto h_rdata = Kokkos::create_mirror_view_and_copy(HostMemSpace(),
+                                                       ppart->prtcl_rdata);
+    auto h_idata = Kokkos::create_mirror_view_and_copy(HostMemSpace(),
+                                                       ppart->prtcl_idata);
+    Kokkos::realloc(prdata, npart, ppart->nrdata);
+    Kokkos::realloc(pidata, npart, ppart->nidata);
+    auto &mbsize = pm->pmb_pack->pmb->mb_size;
+    for (int p=0; p<npart; ++p) {
+      int oldm = h_idata(PGID,p);
+      int newm = oldtonew[oldm];
+      if (refine_flag.h_view(oldm) > 0) {
+        auto &size = mbsize.h_view(oldm - pm->pmb_pack->gids);
+        int ox1 = (h_rdata(IPX,p) >= 0.5*(size.x1min + size.x1max));
+        int ox2 = (h_rdata(IPY,p) >= 0.5*(size.x2min + size.x2max));
+        int ox3 = (pm->three_d)? (h_rdata(IPZ,p) >= 0.5*(size.x3min + size.x3max)) : 0;
+        for (int l=0; l<nleaf; ++l) {
+          LogicalLocation &lloc = new_lloc_eachmb[oldtonew[oldm] + l];
+          if ((lloc.lx1 & 1) == ox1 && (lloc.lx2 & 1) == ox2 && (lloc.lx3 & 1) == ox3) {
+            newm = oldtonew[oldm] + l;
+          }
+        }
+      }
+      for (int n=0; n<ppart->nrdata; ++n) {prdata(p,n) = h_rdata(n,p);}
+      for (int n=0; n<ppart->nidata; ++n) {pidata(p,n) = h_idata(n,p);}
+      pidata(p,PGID) = newm;
+    }
+  }
 
   // Update data in Mesh/MeshBlockPack/MeshBlock classes with new grid properties
   delete [] pm->lloc_eachmb;
@@ -608,12 +717,38 @@ void MeshRefinement::RedistAndRefineMeshBlocks(ParameterInput *pin, int nnew, in
   pm->pmb_pack->nmb_thispack = pm->pmb_pack->gide - pm->pmb_pack->gids + 1;
 
   // Delete old then allocate new MeshBlocks and Coordinates (latter includes masks in GR)
+  // Old Coordinates are deleted only after new ones copy data from unchanged MBs.
+  Coordinates *pold_coord = pm->pmb_pack->pcoord;
   delete (pm->pmb_pack->pmb);
-  delete (pm->pmb_pack->pcoord);
   pm->pmb_pack->AddMeshBlocks(pin);
-  pm->pmb_pack->AddCoordinates(pin);
+  pm->pmb_pack->AddCoordinates(pin, pold_coord, old_mbidx);
+  delete pold_coord;
   pm->pmb_pack->pmb->SetNeighbors(pm->ptree, pm->rank_eachmb);
 
+  // Flag MBs that kept their data (including ghost zones and primitives) on this rank,
+  // and whose neighbors all kept their level.  Their ghost zones and primitives are
+  // unchanged, so only prolongation from coarser neighbors is repeated for them when
+  // boundary values and primitives are reset in AdaptiveMeshRefinement().
+  {
+    auto &pmb = pm->pmb_pack->pmb;
+    for (int m=0; m<nmb_new_thisrank; ++m) {
+      bool unchanged = (old_mbidx[m] >= 0);
+      for (int n=0; n<pmb->nnghbr; ++n) {
+        int gid = pmb->nghbr.h_view(m,n).gid;
+        if ((gid >= 0) && (refine_flag.h_view(newtoold[gid]) != 0)) {unchanged = false;}
+      }
+      pmb->mb_unchanged.h_view(m) = unchanged;
+    }
+    pmb->mb_unchanged.template modify<HostMemSpace>();
+    pmb->mb_unchanged.template sync<DevExeSpace>();
+  }
+  delete [] old_mbidx;
+
+  // send particles to rank owning their new MB (one message per pair of ranks)
+  if (ppart != nullptr) {
+    ppart->RedistributeParticles(prdata, pidata);
+  }
+
   // clean-up
   delete [] newtoold;
   delete [] oldtonew;
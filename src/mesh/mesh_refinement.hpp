@@ -52,12 +52,17 @@ class MeshRefinement {
   int nmb_sent_thisrank;     // # of MeshBlocks sent during load balancing on this rank
   int ncyc_check_amr;        // # of cycles between checking mesh for ref/derefinement
   int refinement_interval;   // # of cycles between allowing successive ref/derefinement
+  int derefine_count;        // # of successive checks MB must be flagged to derefine
+  int nregrid;               // # of times mesh has been regridded by AMR
+  double regrid_time;        // total wall time (s) spent regridding (on this rank)
   bool prolong_prims;        // flag to enable prolongation of primitive vars
+  bool bulk_migration;       // send all MBs migrating between two ranks in one message
   RefinementCriteria* pmrc=nullptr;   // object to control various refinement criteria
 
-  // following 2x Views are dimensioned [nmb_total]
+  // following 3x Views are dimensioned [nmb_total]
   DualArray1D<int> refine_flag;    // refinement flag for each MeshBlock
-  HostArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
+  DualArray1D<int> ncyc_since_ref; // # of cycles since MB last refined/derefined
+  DualArray1D<int> nderef_check;   // # of successive checks MB flagged for derefinement
 
   // following 4x arrays allocated with length [nranks] only with AMR
   int *nref_eachrank;     // number of MBs refined per rank
@@ -127,6 +132,7 @@ class MeshRefinement {
   void ClearRecvAndUnpackAMR();
   void UnpackAMRBuffersCC(DvceArray5D<Real> &a, DvceArray5D<Real> &ca, int ncc,int nfc);
   void UnpackAMRBuffersFC(DvceFaceFld4D<Real> &b,DvceFaceFld4D<Real> &cb,int ncc,int nfc);
+  void CopyAMRBuffersBulk(bool pack);
   void ClearSendAMR();
 
   // initialize interpolation weights
@@ -41,6 +41,9 @@ class MeshBlock {
   DualArray1D<RegionSize> mb_size;   // physical size of each MeshBlock
   DualArray2D<BoundaryFlag> mb_bcs;  // boundary conditions at 6 faces of each MeshBlock
   DualArray2D<NeighborBlock> nghbr;  // data on all (up to 56) neighbors for each MB
+  // true for MBs whose data, level and neighbors did not change in a regrid, only while
+  // boundary values and primitives are reset afterwards (ghost zones/prims are kept)
+  DualArray1D<bool> mb_unchanged;
 
   // function to set data describing neighbors
   void SetNeighbors(std::unique_ptr<MeshBlockTree> &ptree, int *ranklist);
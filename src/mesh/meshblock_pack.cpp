@@ -46,6 +46,10 @@ MeshBlockPack::MeshBlockPack(Mesh *pm, int igids, int igide) :
   tl_map.insert(std::make_pair("before_stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("stagen",std::make_shared<TaskList>()));
   tl_map.insert(std::make_pair("after_stagen",std::make_shared<TaskList>()));
+  // task lists for super-time-stepping of diffusion (empty unless enabled)
+  tl_map.insert(std::make_pair("before_sts",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("sts",std::make_shared<TaskList>()));
+  tl_map.insert(std::make_pair("after_sts",std::make_shared<TaskList>()));
 }
 
 //----------------------------------------------------------------------------------------
@@ -87,10 +91,12 @@ void MeshBlockPack::AddMeshBlocks(ParameterInput *pin) {
 //! \fn MeshBlockPack::AddCoordinates(ParameterInput *pin)
 //! \brief Wrapper function for calling Coordinates constructor inside MeshBlockPack.
 //! Allows for passing of pointer to 'this' pack. Must be called BEFORE AddPhysics()
-//! function, since latter uses data inside Coordinates class.
+//! function, since latter uses data inside Coordinates class.  After AMR, optional
+//! arguments pass old Coordinates and map of unchanged MBs so their data can be copied.
 
-void MeshBlockPack::AddCoordinates(ParameterInput *pin) {
-  pcoord = new Coordinates(pin, this);
+void MeshBlockPack::AddCoordinates(ParameterInput *pin, const Coordinates *pold,
+                                   const int *old_mbidx) {
+  pcoord = new Coordinates(pin, this, pold, old_mbidx);
 }
 
 //----------------------------------------------------------------------------------------
@@ -224,6 +230,18 @@ void MeshBlockPack::AddPhysics(ParameterInput *pin) {
     ptmunu = new Tmunu(this, pin);
   }
 
+  // Super-time-stepping tasks are only added to the single-fluid Hydro and MHD task
+  // lists, so error if STS is requested with modules that assemble their own tasks
+  bool use_sts = ((phydro != nullptr) && phydro->use_sts) ||
+                 ((pmhd != nullptr) && pmhd->use_sts);
+  if (use_sts && (pionn != nullptr || prad != nullptr || pz4c != nullptr ||
+                  padm != nullptr)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<time>/sts_integrator = rkl2 cannot be used with "
+              << "<ion-neutral>, <radiation>, <z4c> or <adm>" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   if (pz4c != nullptr || padm != nullptr) {
     pnr = new numrel::NumericalRelativity(this, pin);
     pnr->AssembleNumericalRelativityTasks(tl_map);
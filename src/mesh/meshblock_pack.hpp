@@ -84,7 +84,8 @@ class MeshBlockPack {
   // functions
   void AddPhysics(ParameterInput *pin);
   void AddMeshBlocks(ParameterInput *pin);
-  void AddCoordinates(ParameterInput *pin);
+  void AddCoordinates(ParameterInput *pin, const Coordinates *pold=nullptr,
+                      const int *old_mbidx=nullptr);
 
  private:
   // data
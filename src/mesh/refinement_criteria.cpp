@@ -7,29 +7,40 @@
 //! \brief Implements constructor and functions in RefinementCriteria class.
 
 #include <iostream>
-#include <algorithm> // max
+#include <algorithm> // find, max, min
+#include <iterator>  // distance
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh.hpp"
 #include "mesh_refinement.hpp"
+#include "nghbr_index.hpp"
 
+#include "coordinates/coordinates.hpp"
+#include "eos/eos.hpp"
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "radiation/radiation.hpp"
 #include "refinement_criteria.hpp"
 #include "utils/utils.hpp"
 
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 //----------------------------------------------------------------------------------------
 // RefinementCriteria constructor:
 
 RefinementCriteria::RefinementCriteria(Mesh *pm, ParameterInput *pin) :
     ncriteria(0),
     nderived(0),
+    ncyc_lookahead(0),
     pmy_mesh(pm),
-    dvars("derived_ref_vars",1,1,1,1,1) {
+    dvars("derived_ref_vars",1,1,1,1,1),
+    nghbr_flag("nghbr_ref_flag",1) {
   // cycle through ParameterInput list and read each <amr_criterion> block
   for (auto it = pin->block.begin(); it != pin->block.end(); ++it) {
     if (it->block_name.compare(0, 13, "amr_criterion") == 0) {
@@ -45,6 +56,8 @@ RefinementCriteria::RefinementCriteria(Mesh *pm, ParameterInput *pin) :
         rcrit0.rmethod = RefCritMethod::location;
       } else if (method.compare("user") == 0) {
         rcrit0.rmethod = RefCritMethod::user;
+      } else if (method.compare("lohner") == 0) {
+        rcrit0.rmethod = RefCritMethod::lohner;
       } else {
         std::cout<<"### FATAL ERROR in "<<__FILE__<<" at line "<<__LINE__<<std::endl;
         Kokkos::abort("Unknown refinement criterion");
@@ -59,6 +72,7 @@ RefinementCriteria::RefinementCriteria(Mesh *pm, ParameterInput *pin) :
       rcrit0.rloc_x2  = pin->GetOrAddReal(it->block_name,"location_x2", 0.0);
       rcrit0.rloc_x3  = pin->GetOrAddReal(it->block_name,"location_x3", 0.0);
       rcrit0.rloc_rad = pin->GetOrAddReal(it->block_name,"location_rad", 0.0);
+      rcrit0.rlohner_eps = pin->GetOrAddReal(it->block_name,"lohner_eps", 0.01);
       rcrit.emplace_back(rcrit0);
     }
   }
@@ -89,6 +103,10 @@ RefinementCriteria::RefinementCriteria(Mesh *pm, ParameterInput *pin) :
     }
   }
 
+  // Predictive refinement: number of cycles ahead over which features that will trigger
+  // refinement are tracked into neighboring MBs, see CheckFused()
+  ncyc_lookahead = pin->GetOrAddInteger("mesh_refinement","lookahead_cycles",0);
+
   // count number of derived variables used for refinement
   // This is necessary to figure out dimensions needed for dvars array
   nderived = 0;
@@ -170,217 +188,381 @@ void RefinementCriteria::SetRefinementData(MeshBlockPack* pmbp, bool count_deriv
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void RefinementCriteria::CheckMinMax()
+//! \fn void RefinementCriteria::CheckLocation()
 //! \brief Checks whether MeshBlock should be flagged for refinement/derefinement based on
-//! min/max of selected variable on device.  Variable is set in SetRefinementData().
+//! whether any part of MeshBlock is within given radius of a given position
 
-void RefinementCriteria::CheckMinMax(MeshBlockPack* pmbp, RefCritData crit) {
+void RefinementCriteria::CheckLocation(MeshBlockPack* pmbp, RefCritData crit) {
   auto &refine_flag = pmbp->pmesh->pmr->refine_flag;
   int mbs = pmbp->pmesh->gids_eachrank[global_variable::my_rank];
-
-  // capture variables for kernels
-  auto &indcs = pmbp->pmesh->mb_indcs;
-  int &is = indcs.is, nx1 = indcs.nx1;
-  int &js = indcs.js, nx2 = indcs.nx2;
-  int &ks = indcs.ks, nx3 = indcs.nx3;
-  const int nkji = nx3*nx2*nx1;
-  const int nji  = nx2*nx1;
   int nmb = pmbp->nmb_thispack;
+  auto &size = pmbp->pmb->mb_size;
+  auto &multi_d = pmbp->pmesh->multi_d;
+  auto &three_d = pmbp->pmesh->three_d;
 
-  auto &valmax = crit.rvalue_max;
-  auto &q0 = crit.rdata;
-  if (valmax < (FLT_MAX)) {  // user has set a max value to check
-    par_for_outer("MaxRefCond",DevExeSpace(), 0, 0, 0, (nmb-1),
-    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
-      Real team_qmax= -(FLT_MAX);
-      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
-      [=](const int idx, Real& qmax) {
-        int k = (idx)/nji;
-        int j = (idx - k*nji)/nx1;
-        int i = (idx - k*nji - j*nx1) + is;
-        j += js;
-        k += ks;
-        qmax = fmax(q0(m,k,j,i), qmax);
-      },Kokkos::Max<Real>(team_qmax));
-      // only derefine when flag has not been set by other criteria
-      int &flag = refine_flag.d_view(m+mbs);
-      if  (team_qmax > valmax)                 {flag = 1;}
-      if ((team_qmax < valmax) && (flag == 0)) {flag = -1;}
-    });
-  }
+  Real &x1 = crit.rloc_x1;
+  Real &x2 = crit.rloc_x2;
+  Real &x3 = crit.rloc_x3;
+  Real &rad = crit.rloc_rad;
+  for (int m = 0; m < nmb; ++m) {
+    // extract MeshBlock bounds
+    Real &x1min = size.h_view(m).x1min;
+    Real &x1max = size.h_view(m).x1max;
+    Real &x2min = size.h_view(m).x2min;
+    Real &x2max = size.h_view(m).x2max;
+    Real &x3min = size.h_view(m).x3min;
+    Real &x3max = size.h_view(m).x3max;
 
-  auto &valmin = crit.rvalue_min;
-  if (valmin > -(FLT_MAX)) {  // user has set a min value to check
-    par_for_outer("MaxRefCond",DevExeSpace(), 0, 0, 0, (nmb-1),
-    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
-      Real team_qmin= -(FLT_MAX);
-      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
-      [=](const int idx, Real& qmin) {
-        int k = (idx)/nji;
-        int j = (idx - k*nji)/nx1;
-        int i = (idx - k*nji - j*nx1) + is;
-        j += js;
-        k += ks;
-        qmin = fmin(q0(m,k,j,i), qmin);
-      },Kokkos::Min<Real>(team_qmin));
-      // only derefine when flag has not been set by other criteria
-      int &flag = refine_flag.d_view(m+mbs);
-      if  (team_qmin < valmin)                 {flag = 1;}
-      if ((team_qmin > valmin) && (flag == 0)) {flag = -1;}
-    });
+    if (((x1min < (x1+rad)) && (x1min > (x1-rad))) ||
+        ((x1max < (x1+rad)) && (x1max > (x1-rad))) ||
+        ((x1max > (x1+rad)) && (x1min < (x1-rad)))) {
+      if (!(multi_d) ||
+          (((x2min < (x2+rad)) && (x2min > (x2-rad))) ||
+           ((x2max < (x2+rad)) && (x2max > (x2-rad))) ||
+           ((x2max > (x2+rad)) && (x2min < (x2-rad)))) ) {
+        if (!(three_d) ||
+            (((x3min < (x3+rad)) && (x3min > (x3-rad))) ||
+             ((x3max < (x3+rad)) && (x3max > (x3-rad))) ||
+             ((x3max > (x3+rad)) && (x3min < (x3-rad)))) ) {
+          refine_flag.h_view(m + mbs) = 1;
+        }
+      }
+    }
   }
-  // sync device array with host
-  refine_flag.template modify<DevExeSpace>();
-  refine_flag.template sync<HostMemSpace>();
+  // sync host array with device
+  refine_flag.template modify<HostMemSpace>();
+  refine_flag.template sync<DevExeSpace>();
   return;
 }
 
 //----------------------------------------------------------------------------------------
-//! \fn void RefinementCriteria::CheckSlope()
-//! \brief Checks whether MeshBlock should be flagged for refinement/derefinement based on
-//! magnitude of normalized slope (dq/q) of selected variable on device.  Variable is set
-//! in SetRefinementData().
+//! \fn void RefinementCriteria::CheckFused()
+//! \brief Evaluates all min_max, slope, second_deriv, and lohner criteria in a single
+//! kernel with one team per MeshBlock.  Each cell contributes to a per-criterion maximum
+//! (and minimum, for min_max) which are reduced together with the ArrayMax reducer, then
+//! one thread per team combines the results into refine_flag.  Criteria are combined in
+//! the order they appear in the input file, with the same rules as the separate Check*()
+//! functions: any criterion can flag refinement, and derefinement is only flagged when
+//! no earlier criterion has set the flag.
+//!
+//! The Lohner estimator (Lohner 1987, Comp. Meth. Appl. Mech. Eng. 61, 323) is the ratio
+//! of second to first differences, summed over each direction:
+//!   E^2 = sum_d (q_{+} - 2q + q_{-})^2 /
+//!         sum_d (|q_{+} - q| + |q - q_{-}| + eps*(|q_{+}| + 2|q| + |q_{-}|))^2
+//! Cross derivatives are omitted.  A MeshBlock is refined when max(E) > value_max, and
+//! derefined when max(E) < value_min (or value_max if value_min is not set).
+//!
+//! With lookahead_cycles>0, each interior cell that triggers refinement is also tracked
+//! forward in time: if the distance it can travel in lookahead_cycles cycles at the local
+//! signal speed reaches a face of the MB, the neighbors across that face (and the edge
+//! and corner neighbors between two or three such faces) are flagged for refinement too.
+//! Only neighbors adjacent to the MB and at the same or a coarser level are flagged, even
+//! if the distance is larger.  Flags of neighbors on other ranks are sent to their owners
+//! with ExchangeNeighborFlags().
 
-void RefinementCriteria::CheckSlope(MeshBlockPack* pmbp, RefCritData crit) {
+void RefinementCriteria::CheckFused(MeshBlockPack* pmbp) {
   auto &refine_flag = pmbp->pmesh->pmr->refine_flag;
   int mbs = pmbp->pmesh->gids_eachrank[global_variable::my_rank];
 
+  // list of criteria that can be fused
+  std::vector<int> ifused;
+  for (int n=0; n<ncriteria; ++n) {
+    if ((rcrit[n].rmethod == RefCritMethod::min_max) ||
+        (rcrit[n].rmethod == RefCritMethod::slope) ||
+        (rcrit[n].rmethod == RefCritMethod::second_deriv) ||
+        (rcrit[n].rmethod == RefCritMethod::lohner)) {
+      ifused.push_back(n);
+    }
+  }
+  int nfused = ifused.size();
+  if (nfused == 0) return;
+
   // capture variables for kernels
   auto &indcs = pmbp->pmesh->mb_indcs;
   int &is = indcs.is, nx1 = indcs.nx1;
   int &js = indcs.js, nx2 = indcs.nx2;
   int &ks = indcs.ks, nx3 = indcs.nx3;
-  const int nkji = nx3*nx2*nx1;
-  const int nji  = nx2*nx1;
   int nmb = pmbp->nmb_thispack;
   auto &multi_d = pmbp->pmesh->multi_d;
   auto &three_d = pmbp->pmesh->three_d;
 
-  auto &valmax = crit.rvalue_max;
-  auto &q0 = crit.rdata;
-  if (valmax < (FLT_MAX)) {  // user has set a max value to check
-    par_for_outer("MaxRefCond",DevExeSpace(), 0, 0, 0, (nmb-1),
-    KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
-      Real team_dqmax= -(FLT_MAX);
-      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
-      [=](const int idx, Real& dqmax) {
-        int k = (idx)/nji;
-        int j = (idx - k*nji)/nx1;
-        int i = (idx - k*nji - j*nx1) + is;
-        j += js;
-        k += ks;
-        Real d2 = SQR(q0(m,k,j,i+1) - q0(m,k,j,i-1));
-        if (multi_d) {d2 += SQR(q0(m,k,j+1,i) - q0(m,k,j-1,i));}
-        if (three_d) {d2 += SQR(q0(m,k+1,j,i) - q0(m,k-1,j,i));}
-        dqmax = fmax((0.5*sqrt(d2)/q0(m,k,j,i)), dqmax);
-      },Kokkos::Max<Real>(team_dqmax));
-      // only derefine when flag has not been set by other criteria
-      int &flag = refine_flag.d_view(m+mbs);
-      if  (team_dqmax > valmax)                 {flag = 1;}
-      if ((team_dqmax < valmax) && (flag == 0)) {flag = -1;}
-    });
-  }
-  // sync device array with host
-  refine_flag.template modify<DevExeSpace>();
-  refine_flag.template sync<HostMemSpace>();
-  return;
-}
-
-//----------------------------------------------------------------------------------------
-//! \fn void RefinementCriteria::CheckSecondDeriv()
-//! \brief Checks whether MeshBlock should be flagged for refinement/derefinement based on
-//! magnitude of normalized second derivative (d2q/q) of selected variable on device.
-//! Variable is set in SetRefinementData().
-
-void RefinementCriteria::CheckSecondDeriv(MeshBlockPack* pmbp, RefCritData crit) {
-  auto &refine_flag = pmbp->pmesh->pmr->refine_flag;
-  int mbs = pmbp->pmesh->gids_eachrank[global_variable::my_rank];
-
-  // capture variables for kernels
-  auto &indcs = pmbp->pmesh->mb_indcs;
-  int &is = indcs.is, nx1 = indcs.nx1;
-  int &js = indcs.js, nx2 = indcs.nx2;
-  int &ks = indcs.ks, nx3 = indcs.nx3;
+  int &ie = indcs.ie, &je = indcs.je, &ke = indcs.ke;
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
-  int nmb = pmbp->nmb_thispack;
-  auto &multi_d = pmbp->pmesh->multi_d;
-  auto &three_d = pmbp->pmesh->three_d;
 
-  auto &valmax = crit.rvalue_max;
-  auto &q0 = crit.rdata;
-  if (valmax < (FLT_MAX)) {  // user has set a max value to check
-    par_for_outer("MaxRefCond",DevExeSpace(), 0, 0, 0, (nmb-1),
+  // With lookahead, last 6 elements of reduction hold maximum over cells flagged for
+  // refinement of (distance travelled in ncyc_lookahead cycles) - (distance to face),
+  // in units of cells, for the [ix1,ox1,ix2,ox2,ix3,ox3] faces.  Signal speed is taken
+  // from the hydro or MHD primitives; with neither (or in relativity) it is set to 1.
+  using RefCritMax = array_max::array_type<Real,(2*NREFCRIT_FUSED+6)>;
+  using RefCritMaxReducer = array_max::ArrayMax<Real,(2*NREFCRIT_FUSED+6)>;
+  bool lookahead = (ncyc_lookahead > 0);
+  Real dt_ahead = ncyc_lookahead*(pmbp->pmesh->dt);
+  int nmb_total = pmbp->pmesh->nmb_total;
+  if (lookahead) {
+    if (nghbr_flag.extent_int(0) != nmb_total) {
+      Kokkos::realloc(nghbr_flag, nmb_total);
+    }
+    Kokkos::deep_copy(nghbr_flag.d_view, 0);
+  }
+  bool use_hydro = (pmbp->phydro != nullptr);
+  bool use_mhd = (pmbp->pmhd != nullptr);
+  bool relativistic = pmbp->pcoord->is_special_relativistic ||
+                      pmbp->pcoord->is_general_relativistic ||
+                      pmbp->pcoord->is_dynamical_relativistic;
+  DvceArray5D<Real> w0_, bcc0_;
+  EOS_Data eos;
+  if (use_mhd) {
+    w0_ = pmbp->pmhd->w0;
+    bcc0_ = pmbp->pmhd->bcc0;
+    eos = pmbp->pmhd->peos->eos_data;
+  } else if (use_hydro) {
+    w0_ = pmbp->phydro->w0;
+    eos = pmbp->phydro->peos->eos_data;
+  }
+  auto &mbsize = pmbp->pmb->mb_size;
+  auto &nghbr = pmbp->pmb->nghbr;
+  auto &mblev = pmbp->pmb->mb_lev;
+  auto &nflag = nghbr_flag;
+
+  // launch fused kernel for successive batches of (at most) NREFCRIT_FUSED criteria
+  for (int nb=0; nb<nfused; nb+=(NREFCRIT_FUSED)) {
+    int nc = std::min((NREFCRIT_FUSED), (nfused - nb));
+    Kokkos::Array<DvceArray5DnSlice,(NREFCRIT_FUSED)> q;
+    Kokkos::Array<RefCritMethod,(NREFCRIT_FUSED)> meth;
+    Kokkos::Array<Real,(NREFCRIT_FUSED)> vmax, vmin, eps;
+    for (int c=0; c<nc; ++c) {
+      RefCritData &crit = rcrit[ifused[nb+c]];
+      q[c] = crit.rdata;
+      meth[c] = crit.rmethod;
+      vmax[c] = crit.rvalue_max;
+      vmin[c] = crit.rvalue_min;
+      eps[c] = crit.rlohner_eps;
+    }
+
+    par_for_outer("FusedRefCond",DevExeSpace(), 0, 0, 0, (nmb-1),
     KOKKOS_LAMBDA(TeamMember_t tmember, const int m) {
-      Real team_d2qmax= -(FLT_MAX);
+      RefCritMax team_max;
       Kokkos::parallel_reduce(Kokkos::TeamThreadRange(tmember, nkji),
-      [=](const int idx, Real& d2qmax) {
+      [=](const int idx, RefCritMax& qmax) {
         int k = (idx)/nji;
         int j = (idx - k*nji)/nx1;
         int i = (idx - k*nji - j*nx1) + is;
         j += js;
         k += ks;
-        Real d2q = q0(m,k,j,i+1) - 2.0*q0(m,k,j,i) + q0(m,k,j,i-1);
-        if (multi_d) {d2q += (q0(m,k,j+1,i) - 2.0*q0(m,k,j,i) + q0(m,k,j-1,i));}
-        if (three_d) {d2q += (q0(m,k+1,j,i) - 2.0*q0(m,k,j,i) + q0(m,k-1,j,i));}
-        d2qmax = fmax((fabs(d2q)/q0(m,k,j,i)), d2qmax);
-      },Kokkos::Max<Real>(team_d2qmax));
-      // only derefine when flag has not been set by other criteria
-      int &flag = refine_flag.d_view(m+mbs);
-      if  (team_d2qmax > valmax)                 {flag = 1;}
-      if ((team_d2qmax < valmax) && (flag == 0)) {flag = -1;}
+        bool trigger = false;
+        for (int c=0; c<nc; ++c) {
+          auto &q0 = q[c];
+          Real q00 = q0(m,k,j,i);
+          Real stat = q00, stat_neg = -(FLT_MAX);
+          if (meth[c] == RefCritMethod::min_max) {
+            stat_neg = -q00;
+          } else if (meth[c] == RefCritMethod::slope) {
+            Real d2 = SQR(q0(m,k,j,i+1) - q0(m,k,j,i-1));
+            if (multi_d) {d2 += SQR(q0(m,k,j+1,i) - q0(m,k,j-1,i));}
+            if (three_d) {d2 += SQR(q0(m,k+1,j,i) - q0(m,k-1,j,i));}
+            stat = 0.5*sqrt(d2)/q00;
+          } else if (meth[c] == RefCritMethod::second_deriv) {
+            Real d2q = q0(m,k,j,i+1) - 2.0*q00 + q0(m,k,j,i-1);
+            if (multi_d) {d2q += (q0(m,k,j+1,i) - 2.0*q00 + q0(m,k,j-1,i));}
+            if (three_d) {d2q += (q0(m,k+1,j,i) - 2.0*q00 + q0(m,k-1,j,i));}
+            stat = fabs(d2q)/q00;
+          } else {  // lohner
+            Real qp = q0(m,k,j,i+1), qm = q0(m,k,j,i-1);
+            Real num = SQR(qp - 2.0*q00 + qm);
+            Real den = SQR(fabs(qp - q00) + fabs(q00 - qm) +
+                           eps[c]*(fabs(qp) + 2.0*fabs(q00) + fabs(qm)));
+            if (multi_d) {
+              qp = q0(m,k,j+1,i); qm = q0(m,k,j-1,i);
+              num += SQR(qp - 2.0*q00 + qm);
+              den += SQR(fabs(qp - q00) + fabs(q00 - qm) +
+                         eps[c]*(fabs(qp) + 2.0*fabs(q00) + fabs(qm)));
+            }
+            if (three_d) {
+              qp = q0(m,k+1,j,i); qm = q0(m,k-1,j,i);
+              num += SQR(qp - 2.0*q00 + qm);
+              den += SQR(fabs(qp - q00) + fabs(q00 - qm) +
+                         eps[c]*(fabs(qp) + 2.0*fabs(q00) + fabs(qm)));
+            }
+            stat = (den > 0.0) ? sqrt(num/den) : 0.0;
+          }
+          qmax.the_array[2*c  ] = fmax(stat, qmax.the_array[2*c]);
+          qmax.the_array[2*c+1] = fmax(stat_neg, qmax.the_array[2*c+1]);
+          if ((vmax[c] < (FLT_MAX)) && (stat > vmax[c])) {trigger = true;}
+          if ((meth[c] == RefCritMethod::min_max) && (vmin[c] > -(FLT_MAX)) &&
+              (q00 < vmin[c])) {trigger = true;}
+        }
+
+        // distance (in cells) a feature in this cell can reach at local signal speed
+        if (lookahead && trigger) {
+          Real dv1 = 1.0, dv2 = 1.0, dv3 = 1.0;
+          if ((use_hydro || use_mhd) && !(relativistic)) {
+            Real &wd = w0_(m,IDN,k,j,i);
+            Real p = (eos.is_ideal)? eos.IdealGasPressure(w0_(m,IEN,k,j,i)) : 0.0;
+            if (use_mhd) {
+              Real &bx = bcc0_(m,IBX,k,j,i);
+              Real &by = bcc0_(m,IBY,k,j,i);
+              Real &bz = bcc0_(m,IBZ,k,j,i);
+              if (eos.is_ideal) {
+                dv1 = eos.IdealMHDFastSpeed(wd, p, bx, by, bz);
+                dv2 = eos.IdealMHDFastSpeed(wd, p, by, bz, bx);
+                dv3 = eos.IdealMHDFastSpeed(wd, p, bz, bx, by);
+              } else {
+                dv1 = eos.IdealMHDFastSpeed(wd, bx, by, bz);
+                dv2 = eos.IdealMHDFastSpeed(wd, by, bz, bx);
+                dv3 = eos.IdealMHDFastSpeed(wd, bz, bx, by);
+              }
+            } else {
+              Real cs = (eos.is_ideal)? eos.IdealHydroSoundSpeed(wd, p) : eos.iso_cs;
+              dv1 = cs; dv2 = cs; dv3 = cs;
+            }
+            dv1 += fabs(w0_(m,IVX,k,j,i));
+            dv2 += fabs(w0_(m,IVY,k,j,i));
+            dv3 += fabs(w0_(m,IVZ,k,j,i));
+          }
+          const int nl = 2*(NREFCRIT_FUSED);
+          Real reach = dt_ahead*dv1/mbsize.d_view(m).dx1;
+          qmax.the_array[nl  ] = fmax(reach - (i - is), qmax.the_array[nl  ]);
+          qmax.the_array[nl+1] = fmax(reach - (ie - i), qmax.the_array[nl+1]);
+          if (multi_d) {
+            reach = dt_ahead*dv2/mbsize.d_view(m).dx2;
+            qmax.the_array[nl+2] = fmax(reach - (j - js), qmax.the_array[nl+2]);
+            qmax.the_array[nl+3] = fmax(reach - (je - j), qmax.the_array[nl+3]);
+          }
+          if (three_d) {
+            reach = dt_ahead*dv3/mbsize.d_view(m).dx3;
+            qmax.the_array[nl+4] = fmax(reach - (k - ks), qmax.the_array[nl+4]);
+            qmax.the_array[nl+5] = fmax(reach - (ke - k), qmax.the_array[nl+5]);
+          }
+        }
+      },RefCritMaxReducer(team_max));
+
+      // combine criteria in order into refine flag.  Only derefine when flag has not
+      // been set by other criteria
+      Kokkos::single(Kokkos::PerTeam(tmember), [&] () {
+        int &flag = refine_flag.d_view(m+mbs);
+        for (int c=0; c<nc; ++c) {
+          Real qmax = team_max.the_array[2*c];
+          Real vderef = vmax[c];
+          if ((meth[c] == RefCritMethod::lohner) && (vmin[c] > -(FLT_MAX))) {
+            vderef = vmin[c];
+          }
+          if (vmax[c] < (FLT_MAX)) {
+            if  (qmax > vmax[c])                 {flag = 1;}
+            if ((qmax < vderef) && (flag == 0)) {flag = -1;}
+          }
+          if ((meth[c] == RefCritMethod::min_max) && (vmin[c] > -(FLT_MAX))) {
+            Real qmin = -team_max.the_array[2*c+1];
+            if  (qmin < vmin[c])                 {flag = 1;}
+            if ((qmin > vmin[c]) && (flag == 0)) {flag = -1;}
+          }
+        }
+
+        // flag face, edge, and corner neighbors reached by features within this MB
+        if (lookahead) {
+          const int nl = 2*(NREFCRIT_FUSED);
+          int ox2s = (multi_d)? -1 : 0, ox2e = (multi_d)? 1 : 0;
+          int ox3s = (three_d)? -1 : 0, ox3e = (three_d)? 1 : 0;
+          for (int ox3=ox3s; ox3<=ox3e; ++ox3) {
+          for (int ox2=ox2s; ox2<=ox2e; ++ox2) {
+          for (int ox1=-1; ox1<=1; ++ox1) {
+            if ((ox1 == 0) && (ox2 == 0) && (ox3 == 0)) continue;
+            if ((ox1 != 0) && (team_max.the_array[nl   + (ox1+1)/2] <= 0.0)) continue;
+            if ((ox2 != 0) && (team_max.the_array[nl+2 + (ox2+1)/2] <= 0.0)) continue;
+            if ((ox3 != 0) && (team_max.the_array[nl+4 + (ox3+1)/2] <= 0.0)) continue;
+            for (int n2=0; n2<=1; ++n2) {
+            for (int n1=0; n1<=1; ++n1) {
+              int n = NeighborIndex(ox1,ox2,ox3,n1,n2);
+              // neighbors already finer than this MB need not be refined again
+              int gid = nghbr.d_view(m,n).gid;
+              if ((gid >= 0) && (nghbr.d_view(m,n).lev <= mblev.d_view(m))) {
+                nflag.d_view(gid) = 1;
+              }
+            }}
+          }}}
+        }
+      });
     });
   }
   // sync device array with host
   refine_flag.template modify<DevExeSpace>();
   refine_flag.template sync<HostMemSpace>();
+
+  // Combine neighbor flags from neighboring ranks, and flag MBs on this rank for
+  // refinement
+  if (lookahead) {
+    nghbr_flag.template modify<DevExeSpace>();
+    nghbr_flag.template sync<HostMemSpace>();
+#if MPI_PARALLEL_ENABLED
+    ExchangeNeighborFlags(pmbp);
+#endif
+    for (int m=0; m<nmb; ++m) {
+      if (nghbr_flag.h_view(m+mbs) > 0) {refine_flag.h_view(m+mbs) = 1;}
+    }
+    refine_flag.template modify<HostMemSpace>();
+    refine_flag.template sync<DevExeSpace>();
+  }
   return;
 }
 
+#if MPI_PARALLEL_ENABLED
 //----------------------------------------------------------------------------------------
-//! \fn void RefinementCriteria::CheckLocation()
-//! \brief Checks whether MeshBlock should be flagged for refinement/derefinement based on
-//! whether any part of MeshBlock is within given radius of a given position
+//! \fn void RefinementCriteria::ExchangeNeighborFlags()
+//! \brief Sends the gids of MBs on other ranks flagged by lookahead in CheckFused() to
+//! the ranks that own them, and sets nghbr_flag (on host) for MBs on this rank flagged by
+//! other ranks.  Only MBs that are neighbors of MBs on this rank can be flagged, and the
+//! neighbor relation is symmetric, so each rank exchanges one (possibly empty) message
+//! with each rank owning a neighbor of its MBs, and no global collective is needed.
 
-void RefinementCriteria::CheckLocation(MeshBlockPack* pmbp, RefCritData crit) {
-  auto &refine_flag = pmbp->pmesh->pmr->refine_flag;
-  int mbs = pmbp->pmesh->gids_eachrank[global_variable::my_rank];
+void RefinementCriteria::ExchangeNeighborFlags(MeshBlockPack* pmbp) {
   int nmb = pmbp->nmb_thispack;
-  auto &size = pmbp->pmb->mb_size;
-  auto &multi_d = pmbp->pmesh->multi_d;
-  auto &three_d = pmbp->pmesh->three_d;
-
-  Real &x1 = crit.rloc_x1;
-  Real &x2 = crit.rloc_x2;
-  Real &x3 = crit.rloc_x3;
-  Real &rad = crit.rloc_rad;
-  for (int m = 0; m < nmb; ++m) {
-    // extract MeshBlock bounds
-    Real &x1min = size.h_view(m).x1min;
-    Real &x1max = size.h_view(m).x1max;
-    Real &x2min = size.h_view(m).x2min;
-    Real &x2max = size.h_view(m).x2max;
-    Real &x3min = size.h_view(m).x3min;
-    Real &x3max = size.h_view(m).x3max;
+  int nnghbr = pmbp->pmb->nnghbr;
+  auto &nghbr = pmbp->pmb->nghbr;
+  auto &nflag = nghbr_flag.h_view;
+  auto &amr_comm = pmbp->pmesh->pmr->amr_comm;
 
-    if (((x1min < (x1+rad)) && (x1min > (x1-rad))) ||
-        ((x1max < (x1+rad)) && (x1max > (x1-rad))) ||
-        ((x1max > (x1+rad)) && (x1min < (x1-rad)))) {
-      if (!(multi_d) ||
-          (((x2min < (x2+rad)) && (x2min > (x2-rad))) ||
-           ((x2max < (x2+rad)) && (x2max > (x2-rad))) ||
-           ((x2max > (x2+rad)) && (x2min < (x2-rad)))) ) {
-        if (!(three_d) ||
-            (((x3min < (x3+rad)) && (x3min > (x3-rad))) ||
-             ((x3max < (x3+rad)) && (x3max > (x3-rad))) ||
-             ((x3max > (x3+rad)) && (x3min < (x3-rad)))) ) {
-          refine_flag.h_view(m + mbs) = 1;
-        }
+  // list of neighbor ranks, and flagged gids owned by each
+  std::vector<int> nranks;
+  std::vector<std::vector<int>> send_gids;
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<nnghbr; ++n) {
+      int gid = nghbr.h_view(m,n).gid;
+      int rank = nghbr.h_view(m,n).rank;
+      if ((gid < 0) || (rank == global_variable::my_rank)) continue;
+      auto it = std::find(nranks.begin(), nranks.end(), rank);
+      int r = std::distance(nranks.begin(), it);
+      if (it == nranks.end()) {
+        nranks.push_back(rank);
+        send_gids.emplace_back();
+      }
+      // each gid is sent once, since its flag is not needed on this rank
+      if (nflag(gid) > 0) {
+        send_gids[r].push_back(gid);
+        nflag(gid) = 0;
       }
     }
   }
-  // sync host array with device
-  refine_flag.template modify<HostMemSpace>();
-  refine_flag.template sync<DevExeSpace>();
+
+  // post sends, then receive one message from each neighbor rank
+  int tag = CreateAMR_MPI_Tag(0, 0, 0, 0);
+  int nr = nranks.size();
+  std::vector<MPI_Request> send_req(nr, MPI_REQUEST_NULL);
+  for (int r=0; r<nr; ++r) {
+    MPI_Isend(send_gids[r].data(), send_gids[r].size(), MPI_INT, nranks[r], tag,
+              amr_comm, &(send_req[r]));
+  }
+  std::vector<int> recv_gids;
+  for (int r=0; r<nr; ++r) {
+    MPI_Status status;
+    int count;
+    MPI_Probe(nranks[r], tag, amr_comm, &status);
+    MPI_Get_count(&status, MPI_INT, &count);
+    recv_gids.resize(count);
+    MPI_Recv(recv_gids.data(), count, MPI_INT, nranks[r], tag, amr_comm,
+             MPI_STATUS_IGNORE);
+    for (int i=0; i<count; ++i) {nflag(recv_gids[i]) = 1;}
+  }
+  MPI_Waitall(nr, send_req.data(), MPI_STATUSES_IGNORE);
   return;
 }
+#endif
@@ -13,9 +13,11 @@
 //!   (2) gradient of selected variable
 //!   (3) second derivative of selected variable
 //!   (4) region with specified radius of a selected point
+//!   (5) Lohner error estimator (normalized second derivative) of selected variable
 //! Any number of refinement criteria can be specified using multiple
 //! <refinement_criteriaN> blocks in the input file.  Each block can select a different
-//! method and/or hydro/MHD/radiation variables can be selected.
+//! method and/or hydro/MHD/radiation variables can be selected.  Criteria (1),(2),(3)
+//! and (5) are evaluated together in a single kernel per cycle, see CheckFused().
 //! TODO(@JMS): user-defined variables can also be selected
 //!
 //! User-defined refinement conditions can also be enrolled by setting the *usr_ref_func
@@ -27,7 +29,11 @@
 #include "athena.hpp"
 
 // identifiers for refinement criteria methods
-enum class RefCritMethod {min_max, slope, second_deriv, location, user};
+enum class RefCritMethod {min_max, slope, second_deriv, location, user, lohner};
+
+// maximum number of criteria evaluated in one fused kernel.  More criteria are handled
+// by launching the fused kernel for successive batches.
+#define NREFCRIT_FUSED 8
 
 using DvceArray5DnSlice = Kokkos::Subview<DvceArray5D<Real>,
                           std::remove_const_t<decltype(Kokkos::ALL)>,
@@ -46,6 +52,7 @@ struct RefCritData {
   Real rvalue_min, rvalue_max;     // min/max criteria for refinement
   Real rloc_x1, rloc_x2, rloc_x3;  // x1-,x2-,x3-locations of point to refine around
   Real rloc_rad;                   // radius of region around point to be refined
+  Real rlohner_eps;                // filter coefficient in Lohner estimator
   DvceArray5DnSlice rdata;         // slice of variable "n" in 5D array(m,n,k,j,i)
 };
 
@@ -61,18 +68,23 @@ class RefinementCriteria {
   // data
   int ncriteria;
   int nderived;
+  int ncyc_lookahead;  // # of cycles ahead that refinement of neighbors is predicted
   std::vector<RefCritData> rcrit;
 
   // functions
   void SetRefinementData(MeshBlockPack* pmbp, bool count, bool load);
-  void CheckMinMax(MeshBlockPack* pmbp, RefCritData crit);
-  void CheckSlope(MeshBlockPack* pmbp, RefCritData crit);
-  void CheckSecondDeriv(MeshBlockPack* pmbp, RefCritData crit);
   void CheckLocation(MeshBlockPack* pmbp, RefCritData crit);
+  void CheckFused(MeshBlockPack* pmbp);
 
  private:
   // data
   Mesh *pmy_mesh;
   DvceArray5D<Real> dvars;  // derived variables
+  DualArray1D<int> nghbr_flag;  // MBs flagged for refinement by neighbors [nmb_total]
+
+  // functions
+#if MPI_PARALLEL_ENABLED
+  void ExchangeNeighborFlags(MeshBlockPack* pmbp);
+#endif
 };
 #endif // MESH_REFINEMENT_CRITERIA_HPP_
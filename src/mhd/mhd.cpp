@@ -53,7 +53,9 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     e3_cc("e3_cc",1,1,1,1),
     utest("utest",1,1,1,1,1),
     bcctest("bcctest",1,1,1,1,1),
-    fofc("fofc",1,1,1,1) {
+    fofc("fofc",1,1,1,1),
+    u_sts0("u_sts0",1,1,1,1,1),
+    dudt_sts0("dudt_sts0",1,1,1,1,1) {
   // Total number of MeshBlocks on this rank to be used in array dimensioning
   int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
 
@@ -151,7 +153,10 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
     int n_ccells2 = (indcs.cnx2 > 1)? (indcs.cnx2 + 2*(indcs.ng)) : 1;
     int n_ccells3 = (indcs.cnx3 > 1)? (indcs.cnx3 + 2*(indcs.ng)) : 1;
     Kokkos::realloc(coarse_u0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
-    Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    // coarse primitives only needed when prolongating primitive variables
+    if (ppack->pmesh->pmr->prolong_prims) {
+      Kokkos::realloc(coarse_w0, nmb, (nmhd+nscalars), n_ccells3, n_ccells2, n_ccells1);
+    }
     Kokkos::realloc(coarse_b0.x1f, nmb, n_ccells3, n_ccells2, n_ccells1+1);
     Kokkos::realloc(coarse_b0.x2f, nmb, n_ccells3, n_ccells2+1, n_ccells1);
     Kokkos::realloc(coarse_b0.x3f, nmb, n_ccells3+1, n_ccells2, n_ccells1);
@@ -323,16 +328,22 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
       Kokkos::realloc(efld.x2e, nmb, ncells3+1, ncells2, ncells1+1);
       Kokkos::realloc(efld.x3e, nmb, ncells3, ncells2+1, ncells1+1);
 
-      // allocate scratch arrays for face- and cell-centered E used in CornerE
+      // allocate scratch arrays for face- and cell-centered E used in CornerE.  Only
+      // the components that are actually computed in a 1D/2D/3D problem are allocated;
+      // the remainder are left as placeholder Views of size 1.
       Kokkos::realloc(e3x1, nmb, ncells3, ncells2, ncells1);
       Kokkos::realloc(e2x1, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
-      Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      if (pmy_pack->pmesh->multi_d) {
+        Kokkos::realloc(e1x2, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e3x2, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e3_cc, nmb, ncells3, ncells2, ncells1);
+      }
+      if (pmy_pack->pmesh->three_d) {
+        Kokkos::realloc(e2x3, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e1x3, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e1_cc, nmb, ncells3, ncells2, ncells1);
+        Kokkos::realloc(e2_cc, nmb, ncells3, ncells2, ncells1);
+      }
 
       // allocate array of flags used with FOFC
       if (use_fofc) {
@@ -343,6 +354,25 @@ MHD::MHD(MeshBlockPack *ppack, ParameterInput *pin) :
         Kokkos::deep_copy(fofc, false);
       }
     }
+
+    // super-time-stepping of diffusion [option already error checked in driver]
+    // Resistivity is always integrated explicitly since it also evolves B through CT
+    std::string sts = pin->GetOrAddString("time","sts_integrator","none");
+    if ((sts.compare("rkl2") == 0) && (pvisc != nullptr || pcond != nullptr)) {
+      if (porb_u != nullptr) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<time>/sts_integrator = " << sts << " cannot be "
+                  << "used with shearing box" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      use_sts = true;
+      auto &indcs = pmy_pack->pmesh->mb_indcs;
+      int ncells1 = indcs.nx1 + 2*(indcs.ng);
+      int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+      int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+      Kokkos::realloc(u_sts0,    nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+      Kokkos::realloc(dudt_sts0, nmb, (nmhd+nscalars), ncells3, ncells2, ncells1);
+    }
   }
 }
 
@@ -380,4 +410,28 @@ void MHD::SetSaveWBcc() {
   wbcc_saved = true;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn std::size_t MHD::DeviceMemoryBytes()
+//! \brief Returns total number of bytes currently allocated on the device for the Views
+//! owned by the MHD class (excluding boundary buffers and diffusion/source modules).
+
+std::size_t MHD::DeviceMemoryBytes() const {
+  std::size_t nbytes = 0;
+  nbytes += sizeof(Real)*(u0.span() + w0.span() + bcc0.span() + u1.span());
+  nbytes += sizeof(Real)*(b0.x1f.span() + b0.x2f.span() + b0.x3f.span());
+  nbytes += sizeof(Real)*(b1.x1f.span() + b1.x2f.span() + b1.x3f.span());
+  nbytes += sizeof(Real)*(coarse_u0.span() + coarse_w0.span());
+  nbytes += sizeof(Real)*(coarse_b0.x1f.span()+coarse_b0.x2f.span()+coarse_b0.x3f.span());
+  nbytes += sizeof(Real)*(uflx.x1f.span() + uflx.x2f.span() + uflx.x3f.span());
+  nbytes += sizeof(Real)*(efld.x1e.span() + efld.x2e.span() + efld.x3e.span());
+  nbytes += sizeof(Real)*(e3x1.span() + e2x1.span() + e1x2.span() + e3x2.span() +
+                          e2x3.span() + e1x3.span());
+  nbytes += sizeof(Real)*(e1_cc.span() + e2_cc.span() + e3_cc.span());
+  nbytes += sizeof(Real)*(wsaved.span() + bccsaved.span());
+  nbytes += sizeof(Real)*(utest.span() + bcctest.span());
+  nbytes += sizeof(bool)*fofc.span();
+  nbytes += sizeof(Real)*(u_sts0.span() + dudt_sts0.span());
+  return nbytes;
+}
+
 } // namespace mhd
@@ -78,6 +78,19 @@ struct MHDTaskIDs {
   TaskID newdt;
   TaskID csend;
   TaskID crecv;
+  TaskID irecv_sts;
+  TaskID flux_sts;
+  TaskID sendf_sts;
+  TaskID recvf_sts;
+  TaskID stsupdt;
+  TaskID restu_sts;
+  TaskID sendu_sts;
+  TaskID recvu_sts;
+  TaskID bcs_sts;
+  TaskID prol_sts;
+  TaskID c2p_sts;
+  TaskID csend_sts;
+  TaskID crecv_sts;
 };
 
 namespace mhd {
@@ -143,11 +156,17 @@ class MHD {
   DvceArray4D<bool> fofc;  // flag for each cell to indicate if FOFC is needed
   bool use_fofc = false;   // flag to enable FOFC
 
+  // following used for super-time-stepping (STS) of viscosity and conduction
+  bool use_sts = false;        // flag to enable operator-split RKL2 STS of diffusion
+  DvceArray5D<Real> u_sts0;    // conserved variables at start of STS (Y_0)
+  DvceArray5D<Real> dudt_sts0; // diffusion operator evaluated at start of STS, L(Y_0)
+
   // container to hold names of TaskIDs
   MHDTaskIDs id;
 
   // functions...
   void SetSaveWBcc();
+  std::size_t DeviceMemoryBytes() const;
   void AssembleMHDTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
   // ...in "before_timeintegrator" task list
   TaskStatus SaveMHDState(Driver *d, int stage);
@@ -186,6 +205,12 @@ class MHD {
   // ...in "after_stagen_tl" task list
   TaskStatus ClearSend(Driver *d, int stage);
   TaskStatus ClearRecv(Driver *d, int stage);  // also in Driver::Initialize
+  // ...in "before_sts", "sts", and "after_sts" task lists
+  TaskStatus InitRecvSTS(Driver *d, int stage);
+  TaskStatus FluxesSTS(Driver *d, int stage);
+  TaskStatus STSUpdate(Driver *d, int stage);
+  TaskStatus ClearSendSTS(Driver *d, int stage);
+  TaskStatus ClearRecvSTS(Driver *d, int stage);
 
   // CalculateFluxes function templated over Riemann Solvers
   template <MHD_RSolver T>
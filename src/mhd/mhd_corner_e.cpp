@@ -64,7 +64,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMF in dynamical GRMHD
     if (pmy_pack->padm != nullptr) {
-      auto &adm = pmy_pack->padm->adm;
+      auto adm = pmy_pack->padm->GetADMView();
       par_for("e_cc_2d", DevExeSpace(), 0, nmb1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int j, int i) {
         // Calculate the spatial components of the three-velocity
@@ -216,7 +216,7 @@ TaskStatus MHD::CornerE(Driver *pdriver, int stage) {
 
     // compute cell-centered EMFs in dynamical GRMHD
     if (pmy_pack->padm != nullptr) {
-      auto &adm = pmy_pack->padm->adm;
+      auto adm = pmy_pack->padm->GetADMView();
       par_for("e_cc_3d", DevExeSpace(), 0, nmb1, ks-1, ke+1, js-1, je+1, is-1, ie+1,
       KOKKOS_LAMBDA(int m, int k, int j, int i) {
         // Calculate something that resembles the spatial components of the four-velocity
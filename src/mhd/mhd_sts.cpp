@@ -0,0 +1,160 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file mhd_sts.cpp
+//! \brief Task list functions that implement operator-split super-time-stepping (STS) of
+//! viscosity and thermal conduction in MHD using the RKL2 method.  The diffusion
+//! operator is advanced over the full hyperbolic timestep in s stages, each of which is
+//! stable with the explicit parabolic timestep limit, so that the parabolic limit no
+//! longer throttles dt.  Stage weights are set in Driver::SetRKL2Weights().
+
+#include "athena.hpp"
+#include "mesh/mesh.hpp"
+#include "driver/driver.hpp"
+#include "eos/eos.hpp"
+#include "diffusion/viscosity.hpp"
+#include "diffusion/conduction.hpp"
+#include "bvals/bvals.hpp"
+#include "mhd.hpp"
+
+namespace mhd {
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::InitRecvSTS
+//! \brief Posts non-blocking receives for U (and fluxes of U with SMR/AMR) for each STS
+//! stage.  B is not evolved and shearing box is not supported with STS, so no other
+//! receives are needed.
+
+TaskStatus MHD::InitRecvSTS(Driver *pdrive, int stage) {
+  TaskStatus tstat = pbval_u->InitRecv(nmhd+nscalars);
+  if (tstat != TaskStatus::complete) return tstat;
+
+  // with SMR/AMR post receives for fluxes of U
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->InitFluxRecv(nmhd+nscalars);
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::FluxesSTS
+//! \brief Computes only the diffusive (viscous and heat) fluxes of conserved variables
+
+TaskStatus MHD::FluxesSTS(Driver *pdrive, int stage) {
+  Kokkos::deep_copy(DevExeSpace(), uflx.x1f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x2f, 0.0);
+  Kokkos::deep_copy(DevExeSpace(), uflx.x3f, 0.0);
+
+  if (pvisc != nullptr) {
+    pvisc->IsotropicViscousFlux(w0, pvisc->nu_iso, peos->eos_data, uflx);
+  }
+  if (pcond != nullptr) {
+    pcond->AddHeatFlux(w0, peos->eos_data, uflx);
+  }
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::STSUpdate
+//! \brief Update of conserved variables for one RKL2 stage.  On entry u0 holds Y_{j-1}
+//! and u1 holds Y_{j-2}; on exit u0 holds Y_j and u1 holds Y_{j-1}.  In the first stage
+//! Y_0 and L(Y_0) are saved in u_sts0 and dudt_sts0.
+
+TaskStatus MHD::STSUpdate(Driver *pdriver, int stage) {
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, ie = indcs.ie;
+  int js = indcs.js, je = indcs.je;
+  int ks = indcs.ks, ke = indcs.ke;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+
+  Real &dt = pmy_pack->pmesh->dt;
+  Real mu = pdriver->sts_mu[stage-1];
+  Real nu = pdriver->sts_nu[stage-1];
+  Real mut_dt = (pdriver->sts_mut[stage-1])*dt;
+  Real gamt_dt = (pdriver->sts_gamt[stage-1])*dt;
+  bool first_stage = (stage == 1);
+  int nmb1 = pmy_pack->nmb_thispack - 1;
+  int nvar = nmhd + nscalars;
+  auto u0_ = u0;
+  auto u1_ = u1;
+  auto y0_ = u_sts0;
+  auto ly0_ = dudt_sts0;
+  auto flx1 = uflx.x1f;
+  auto flx2 = uflx.x2f;
+  auto flx3 = uflx.x3f;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+
+  int scr_level = 0;
+  size_t scr_size = ScrArray1D<Real>::shmem_size(ncells1);
+
+  par_for_outer("m_sts",DevExeSpace(),scr_size,scr_level,0,nmb1,0,nvar-1,ks,ke,js,je,
+  KOKKOS_LAMBDA(TeamMember_t member, const int m, const int n, const int k, const int j) {
+    ScrArray1D<Real> divf(member.team_scratch(scr_level), ncells1);
+
+    // compute dF1/dx1
+    par_for_inner(member, is, ie, [&](const int i) {
+      divf(i) = (flx1(m,n,k,j,i+1) - flx1(m,n,k,j,i))/mbsize.d_view(m).dx1;
+    });
+    member.team_barrier();
+
+    // Add dF2/dx2
+    if (multi_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx2(m,n,k,j+1,i) - flx2(m,n,k,j,i))/mbsize.d_view(m).dx2;
+      });
+      member.team_barrier();
+    }
+
+    // Add dF3/dx3
+    if (three_d) {
+      par_for_inner(member, is, ie, [&](const int i) {
+        divf(i) += (flx3(m,n,k+1,j,i) - flx3(m,n,k,j,i))/mbsize.d_view(m).dx3;
+      });
+      member.team_barrier();
+    }
+
+    par_for_inner(member, is, ie, [&](const int i) {
+      if (first_stage) {
+        y0_(m,n,k,j,i) = u0_(m,n,k,j,i);
+        ly0_(m,n,k,j,i) = -divf(i);
+      }
+      Real ujm1 = u0_(m,n,k,j,i);
+      u0_(m,n,k,j,i) = mu*ujm1 + nu*u1_(m,n,k,j,i) + (1.0 - mu - nu)*y0_(m,n,k,j,i)
+                     - mut_dt*divf(i) + gamt_dt*ly0_(m,n,k,j,i);
+      u1_(m,n,k,j,i) = ujm1;
+    });
+  });
+  return TaskStatus::complete;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ClearSendSTS
+//! \brief Checks all MPI sends of U (and fluxes of U with SMR/AMR) in STS stage complete
+
+TaskStatus MHD::ClearSendSTS(Driver *pdrive, int stage) {
+  TaskStatus tstat = pbval_u->ClearSend();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->ClearFluxSend();
+  }
+  return tstat;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskStatus MHD::ClearRecvSTS
+//! \brief Checks all MPI receives of U (and fluxes of U with SMR/AMR) in STS stage done
+
+TaskStatus MHD::ClearRecvSTS(Driver *pdrive, int stage) {
+  TaskStatus tstat = pbval_u->ClearRecv();
+  if (tstat != TaskStatus::complete) return tstat;
+
+  if (pmy_pack->pmesh->multilevel) {
+    tstat = pbval_u->ClearFluxRecv();
+  }
+  return tstat;
+}
+} // namespace mhd
@@ -8,6 +8,7 @@
 //! \file llf_grmhd.hpp
 //! \brief LLF Riemann solver for general relativistic MHD.
 
+#include "coordinates/cartesian_ks.hpp"
 #include "coordinates/cell_locations.hpp"
 #include "llf_mhd_singlestate.hpp"
 
@@ -29,11 +30,16 @@ void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
   int iby = ((ivx-IVX) + 1)%3;
   int ibz = ((ivx-IVX) + 2)%3;
 
+  auto &flat = coord.is_minkowski;
+  auto &spin = coord.bh_spin;
+  auto &cache = coord.cache_metric;
+  auto &gface = (ivx == IVX) ? coord.gx1f : ((ivx == IVY) ? coord.gx2f : coord.gx3f);
+
   int is = indcs.is;
   int js = indcs.js;
   int ks = indcs.ks;
   par_for_inner(member, il, iu, [&](const int i) {
-    // Extract position of interface
+    // Extract position of interface and metric there
     Real &x1min = size.d_view(m).x1min;
     Real &x1max = size.d_view(m).x1max;
     Real &x2min = size.d_view(m).x2min;
@@ -54,6 +60,12 @@ void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
       x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
       x3v = LeftEdgeX  (k-ks, indcs.nx3, x3min, x3max);
     }
+    Real glower[4][4], gupper[4][4];
+    if (cache) {
+      LoadMetricAndInverse(gface, m, k, j, i, glower, gupper);
+    } else {
+      ComputeMetricAndInverse(x1v, x2v, x3v, flat, spin, glower, gupper);
+    }
 
     // Extract left/right primitives.  Note 1/2/3 always refers to x1/2/3 dirs
     MHDPrim1D wli,wri;
@@ -79,7 +91,7 @@ void LLF_GR(TeamMember_t const &member, const EOS_Data &eos,
 
     // Call LLF solver on single interface state
     MHDCons1D flux;
-    SingleStateLLF_GRMHD(wli, wri, bxi, x1v, x2v, x3v, ivx, coord, eos, flux);
+    SingleStateLLF_GRMHD(wli, wri, bxi, glower, gupper, ivx, eos, flux);
 
     // Store results in 3D array of fluxes
     flx(m,IDN,k,j,i) = flux.d;
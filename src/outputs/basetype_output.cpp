@@ -613,6 +613,12 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
     for (int v = 0; v < adm::ADM::nadm - 4; ++v) {
       if (variable.compare("adm") == 0 ||
           variable.compare(adm::ADM::ADM_names[v]) == 0) {
+        if (!(pm->pmb_pack->padm->store_z4c_adm)) {
+          std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                    << std::endl << "Output of ADM variables requires <z4c>/store_adm"
+                    << " = true" << std::endl;
+          std::exit(EXIT_FAILURE);
+        }
         outvars.emplace_back(adm::ADM::ADM_names[v], v, &(pm->pmb_pack->padm->u_adm));
       }
     }
@@ -640,6 +646,7 @@ BaseTypeOutput::BaseTypeOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
           variable.compare(z4c::Z4c::Constraint_names[v]) == 0) {
         outvars.emplace_back(z4c::Z4c::Constraint_names[v], v,
         &(pm->pmb_pack->pz4c->u_con));
+        uses_z4c_con = true;
       }
     }
 
@@ -1021,9 +1021,10 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
     auto nh_c_ = pm->pmb_pack->prad->nh_c;
     auto tet_c_ = pm->pmb_pack->prad->tet_c;
     auto tetcov_c_ = pm->pmb_pack->prad->tetcov_c;
+    auto norm_to_tet_ = pm->pmb_pack->prad->norm_to_tet;
+    bool &tet_otf = pm->pmb_pack->prad->tetrad_on_the_fly;
     auto solid_angles_ = pm->pmb_pack->prad->prgeo->solid_angles;
     auto i0_ = pm->pmb_pack->prad->i0;
-    auto norm_to_tet_ = pm->pmb_pack->prad->norm_to_tet;
 
     // Select either Hydro or MHD (if fluid enabled)
     DvceArray5D<Real> w0_;
@@ -1051,8 +1052,12 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
       Real glower[4][4], gupper[4][4];
       ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
 
+      // stored tetrad, or evaluated analytically with tetrad_on_the_fly
+      Real e[4][4], ecov[4][4];
+      CellTetrad(tet_c_,tetcov_c_,tet_otf,x1v,x2v,x3v,flat,spin,glower,m,k,j,i,e,ecov);
+
       // coordinate component n^0
-      Real n0 = tet_c_(m,0,0,k,j,i);
+      Real n0 = e[0][0];
 
       // set coordinate frame components
       for (int n1=0, n12=0; n1<4; ++n1) {
@@ -1061,9 +1066,9 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
           for (int n=0; n<=nang1; ++n) {
             Real nmun1 = 0.0; Real nmun2 = 0.0; Real n_0 = 0.0;
             for (int d=0; d<4; ++d) {
-              nmun1 += tet_c_   (m,d,n1,k,j,i)*nh_c_.d_view(n,d);
-              nmun2 += tet_c_   (m,d,n2,k,j,i)*nh_c_.d_view(n,d);
-              n_0   += tetcov_c_(m,d,0, k,j,i)*nh_c_.d_view(n,d);
+              nmun1 += e[d][n1]*nh_c_.d_view(n,d);
+              nmun2 += e[d][n2]*nh_c_.d_view(n,d);
+              n_0   += ecov[d][0]*nh_c_.d_view(n,d);
             }
             dv(m,n12,k,j,i) += (nmun1*nmun2*(i0_(m,n,k,j,i)/(n0*n_0))*
                                 solid_angles_.d_view(n));
@@ -1099,15 +1104,20 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
                + glower[2][2]*uu2*uu2+2.0*glower[2][3]*uu2*uu3
                + glower[3][3]*uu3*uu3;
         Real uu0 = sqrt(1.0 + q);
+        Real ntt[4][4];
+        if (tet_otf) {
+          Real ecov_[4][4];
+          ComputeNormToTetrad(e,glower,gupper,ecov_,ntt);
+        } else {
+          for (int d1=0; d1<4; ++d1) {
+            for (int d2=0; d2<4; ++d2) { ntt[d1][d2] = norm_to_tet_(m,d1,d2,k,j,i); }
+          }
+        }
         Real u_tet_[4];
-        u_tet_[0] = (norm_to_tet_(m,0,0,k,j,i)*uu0 + norm_to_tet_(m,0,1,k,j,i)*uu1 +
-                     norm_to_tet_(m,0,2,k,j,i)*uu2 + norm_to_tet_(m,0,3,k,j,i)*uu3);
-        u_tet_[1] = (norm_to_tet_(m,1,0,k,j,i)*uu0 + norm_to_tet_(m,1,1,k,j,i)*uu1 +
-                     norm_to_tet_(m,1,2,k,j,i)*uu2 + norm_to_tet_(m,1,3,k,j,i)*uu3);
-        u_tet_[2] = (norm_to_tet_(m,2,0,k,j,i)*uu0 + norm_to_tet_(m,2,1,k,j,i)*uu1 +
-                     norm_to_tet_(m,2,2,k,j,i)*uu2 + norm_to_tet_(m,2,3,k,j,i)*uu3);
-        u_tet_[3] = (norm_to_tet_(m,3,0,k,j,i)*uu0 + norm_to_tet_(m,3,1,k,j,i)*uu1 +
-                     norm_to_tet_(m,3,2,k,j,i)*uu2 + norm_to_tet_(m,3,3,k,j,i)*uu3);
+        u_tet_[0] = (ntt[0][0]*uu0 + ntt[0][1]*uu1 + ntt[0][2]*uu2 + ntt[0][3]*uu3);
+        u_tet_[1] = (ntt[1][0]*uu0 + ntt[1][1]*uu1 + ntt[1][2]*uu2 + ntt[1][3]*uu3);
+        u_tet_[2] = (ntt[2][0]*uu0 + ntt[2][1]*uu1 + ntt[2][2]*uu2 + ntt[2][3]*uu3);
+        u_tet_[3] = (ntt[3][0]*uu0 + ntt[3][1]*uu1 + ntt[3][2]*uu2 + ntt[3][3]*uu3);
 
         // Construct Lorentz boost from tetrad frame to orthonormal fluid frame
         Real tet_to_fluid[4][4];
@@ -1134,8 +1144,7 @@ void BaseTypeOutput::ComputeDerivedVariable(std::string name, Mesh *pm) {
             dv(m,moments_offset+n12,k,j,i) = 0.0;
             for (int m1=0; m1<4; ++m1) {
               for (int m2=0; m2<4; ++m2) {
-                dv(m,moments_offset+n12,k,j,i) += (tetcov_c_(m,n1,m1,k,j,i)*
-                                                   tetcov_c_(m,n2,m2,k,j,i)*
+                dv(m,moments_offset+n12,k,j,i) += (ecov[n1][m1]*ecov[n2][m2]*
                                                    moments_coord[m1][m2]);
               }
             }
@@ -18,6 +18,8 @@
 #include "athena.hpp"
 #include "globals.hpp"
 #include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "mhd/mhd.hpp"
 #include "outputs.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -28,6 +30,17 @@ EventLogOutput::EventLogOutput(ParameterInput *pin, Mesh *pm, OutputParameters o
   header_written = false;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn int *C2PIterHist()
+//! \brief returns histogram of GR C2P iteration counts stored in the MHD EOS, or nullptr
+//! if it is not being collected
+
+static int *C2PIterHist(Mesh *pm) {
+  auto *pmhd = pm->pmb_pack->pmhd;
+  if (pmhd == nullptr || !(pmhd->peos->eos_data.c2p_warm_start)) {return nullptr;}
+  return pmhd->peos->c2p_iter_hist;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void EventLogOutput::LoadOutputData()
 //! \brief sums event counter data across MPI ranks
@@ -50,6 +63,13 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
   MPI_Allreduce(MPI_IN_PLACE, pmaxit,  1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
   MPI_Allreduce(MPI_IN_PLACE, pfofc,   1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
 #endif
+  // histogram of GR C2P iterations is only collected with <mhd>/c2p_warm_start
+  int *phist = C2PIterHist(pm);
+#if MPI_PARALLEL_ENABLED
+  if (phist != nullptr) {
+    MPI_Allreduce(MPI_IN_PLACE, phist, (NC2P_HIST), MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+  }
+#endif
 
   // check if there is any data to be written
   no_output = true;
@@ -62,6 +82,11 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
       pm->ecounter.maxit_c2p > 0) {
     no_output=false;
   }
+  if (phist != nullptr) {
+    for (int b=0; b<(NC2P_HIST); ++b) {
+      if (phist[b] > 0) {no_output=false;}
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------
@@ -70,6 +95,7 @@ void EventLogOutput::LoadOutputData(Mesh *pm) {
 
 void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   if (header_written && no_output) return;
+  int *phist = C2PIterHist(pm);
 
   // only the master rank writes the file
   if (global_variable::my_rank == 0) {
@@ -92,6 +118,11 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       std::fprintf(pfile,"# Athena event counter data\n");
       std::fprintf(pfile,"#  cycle eos_dfloor eos_efloor eos_tfloor eos_vceil");
       std::fprintf(pfile," eos_fail c2p_it fofc");
+      if (phist != nullptr) {
+        for (int b=0; b<(NC2P_HIST); ++b) {
+          std::fprintf(pfile," c2p_h%d", b);
+        }
+      }
       std::fprintf(pfile,"\n");  // terminate line
       header_written = true;
     }
@@ -106,6 +137,11 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
       std::fprintf(pfile, " %8d", pm->ecounter.neos_fail);
       std::fprintf(pfile, " %6d", pm->ecounter.maxit_c2p);
       std::fprintf(pfile, " %8d", pm->ecounter.nfofc);
+      if (phist != nullptr) {
+        for (int b=0; b<(NC2P_HIST); ++b) {
+          std::fprintf(pfile, " %8d", phist[b]);
+        }
+      }
       std::fprintf(pfile,"\n"); // terminate line
     }
     std::fclose(pfile);
@@ -119,6 +155,9 @@ void EventLogOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
   pm->ecounter.neos_fail = 0;
   pm->ecounter.maxit_c2p = 0;
   pm->ecounter.nfofc = 0;
+  if (phist != nullptr) {
+    for (int b=0; b<(NC2P_HIST); ++b) {phist[b] = 0;}
+  }
 
   // increment output time, clean up
   if (out_params.last_time < 0.0) {
@@ -48,6 +48,7 @@ HistoryOutput::HistoryOutput(ParameterInput *pin, Mesh *pm, OutputParameters op)
 
   if (pm->pmb_pack->pz4c != nullptr) {
     hist_data.emplace_back(PhysicsModule::SpaceTimeDynamics);
+    uses_z4c_con = true;
   }
 }
 
@@ -191,7 +192,7 @@ void HistoryOutput::LoadZ4cHistoryData(HistoryData *pdata, Mesh *pm) {
   auto &u_con_ = pm->pmb_pack->pz4c->u_con;
   const int &I_Z4c_Theta_ =  pm->pmb_pack->pz4c->I_Z4C_THETA;
   auto &z4c = pm->pmb_pack->pz4c->z4c;
-  auto &adm = pm->pmb_pack->padm->adm;
+  auto adm = pm->pmb_pack->padm->GetADMView();
 
   auto &size = pm->pmb_pack->pmb->mb_size;
   int &nhist_ = pdata->nhist;
@@ -218,6 +218,7 @@ class BaseTypeOutput {
   // data
   OutputParameters out_params;   // params read from <output> block for this type
   DvceArray5D<Real> derived_var; // array to store output variables computed from u0/b0
+  bool uses_z4c_con=false;       // output reads Z4c constraints, see Z4c::con_needed
 
   // function which computes derived output variables like vorticity and current density
   void ComputeDerivedVariable(std::string name, Mesh *pm);
@@ -385,6 +386,10 @@ class RestartOutput : public BaseTypeOutput {
   RestartOutput(ParameterInput *pin, Mesh *pm, OutputParameters oparams);
   void LoadOutputData(Mesh *pm) override;
   void WriteOutputFile(Mesh *pm, ParameterInput *pin) override;
+ protected:
+  // particle data on host with dims (nprtcl,nrdata) and (nprtcl,nidata)
+  HostArray2D<Real> outpart_rdata;
+  HostArray2D<int>  outpart_idata;
 };
 
 // Forward declaration
@@ -16,6 +16,7 @@
 #include <sstream>
 #include <string>
 #include <utility> // make_pair
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/cell_locations.hpp"
@@ -29,6 +30,7 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "particles/particles.hpp"
 //#include "outputs.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -109,6 +111,7 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
   if (pturb != nullptr) {
+    pturb->SyncRNGStateToHost();
     Kokkos::realloc(outarray_force, nmb, nforce, nout3, nout2, nout1);
     Kokkos::deep_copy(outarray_force, Kokkos::subview(pturb->force, std::make_pair(0,nmb),
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
@@ -123,6 +126,23 @@ void RestartOutput::LoadOutputData(Mesh *pm) {
                       Kokkos::ALL, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL));
   }
 
+  // particles are stored with all data of each particle contiguous, so that the layout
+  // in the file does not depend on how particles are distributed over ranks
+  particles::Particles* ppart = pm->pmb_pack->ppart;
+  if (ppart != nullptr) {
+    int npart = ppart->nprtcl_thispack;
+    auto h_rdata = Kokkos::create_mirror_view_and_copy(HostMemSpace(),
+                                                      ppart->prtcl_rdata);
+    auto h_idata = Kokkos::create_mirror_view_and_copy(HostMemSpace(),
+                                                      ppart->prtcl_idata);
+    Kokkos::realloc(outpart_rdata, npart, ppart->nrdata);
+    Kokkos::realloc(outpart_idata, npart, ppart->nidata);
+    for (int p=0; p<npart; ++p) {
+      for (int n=0; n<ppart->nrdata; ++n) {outpart_rdata(p,n) = h_rdata(n,p);}
+      for (int n=0; n<ppart->nidata; ++n) {outpart_idata(p,n) = h_idata(n,p);}
+    }
+  }
+
   // calculate max/min number of MeshBlocks across all ranks
   noutmbs_max = pm->nmb_eachrank[0];
   noutmbs_min = pm->nmb_eachrank[0];
@@ -623,6 +643,65 @@ void RestartOutput::WriteOutputFile(Mesh *pm, ParameterInput *pin) {
     myoffset = offset_myrank;
   }
 
+  //--- STEP 5.  All ranks write particle data in parallel, after data for all MeshBlocks
+  // Root writes total number of particles and nrdata/nidata, followed by real data of all
+  // particles, then integer data of all particles.  Each rank writes at an offset given
+  // by the number of particles on lower ranks.  This data read in ProblemGenerator
+  // constructor for restarts.
+  particles::Particles* ppart = pm->pmb_pack->ppart;
+  if (ppart != nullptr) {
+    int nrdata = ppart->nrdata, nidata = ppart->nidata;
+    int npart = ppart->nprtcl_thispack;
+    // particles move between ranks, so numbers on each rank are recomputed here
+    std::vector<int> npart_eachrank(global_variable::nranks, npart);
+#if MPI_PARALLEL_ENABLED
+    MPI_Allgather(&npart, 1, MPI_INT, npart_eachrank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+#endif
+    IOWrapperSizeT npart_total = npart, npart_before = 0;
+    if (!single_file_per_rank) {
+      npart_total = 0;
+      for (int n=0; n<global_variable::nranks; ++n) {
+        if (n < global_variable::my_rank) npart_before += npart_eachrank[n];
+        npart_total += npart_eachrank[n];
+      }
+    }
+    IOWrapperSizeT part_offset = step1size + step2size + step3size
+                                 + sizeof(IOWrapperSizeT);
+    if (single_file_per_rank) {
+      part_offset += data_size*(pm->nmb_thisrank);
+    } else {
+      part_offset += data_size*(pm->nmb_total);
+    }
+    if (global_variable::my_rank == 0 || single_file_per_rank) {
+      int ndata[2] = {nrdata, nidata};
+      resfile.Write_any_type_at(&npart_total, sizeof(IOWrapperSizeT), part_offset,
+                                "byte", single_file_per_rank);
+      resfile.Write_any_type_at(&ndata[0], 2, part_offset + sizeof(IOWrapperSizeT),
+                                "int", single_file_per_rank);
+    }
+    part_offset += sizeof(IOWrapperSizeT) + 2*sizeof(int);
+
+    IOWrapperSizeT cnt = static_cast<IOWrapperSizeT>(npart)*nrdata;
+    myoffset = part_offset + npart_before*nrdata*sizeof(Real);
+    if (resfile.Write_any_type_at_all(outpart_rdata.data(), cnt, myoffset, "Real",
+                                      single_file_per_rank) != cnt) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "particle real data not written correctly to rst file, "
+                << "restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    cnt = static_cast<IOWrapperSizeT>(npart)*nidata;
+    myoffset = part_offset + npart_total*nrdata*sizeof(Real)
+               + npart_before*nidata*sizeof(int);
+    if (resfile.Write_any_type_at_all(outpart_idata.data(), cnt, myoffset, "int",
+                                      single_file_per_rank) != cnt) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "particle integer data not written correctly to rst "
+                << "file, restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+  }
+
   // close file, clean up
   resfile.Close(single_file_per_rank);
 
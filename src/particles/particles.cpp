@@ -9,19 +9,31 @@
 #include <iostream>
 #include <string>
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
+#include "coordinates/coordinates.hpp"
 #include "bvals/bvals.hpp"
 #include "particles.hpp"
 
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 namespace particles {
 //----------------------------------------------------------------------------------------
 // constructor, initializes data structures and parameters
 
 Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
+    dtnew(std::numeric_limits<float>::max()),
+    q_over_m(1.0),
+    c_light(1.0),
+    cfl_part(0.5),
+    max_gyrophase(0.3),
     pmy_pack(ppack) {
   // check this is at least a 2D problem
   if (pmy_pack->pmesh->one_d) {
@@ -58,6 +70,27 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
     std::string ppush = pin->GetString("particles","pusher");
     if (ppush.compare("drift") == 0) {
       pusher = ParticlesPusher::drift;
+    } else if (ppush.compare("boris") == 0) {
+      pusher = ParticlesPusher::boris;
+      // Lorentz force computed from fields interpolated from MHD
+      if (pmy_pack->pmhd == nullptr || pmy_pack->pcoord->is_general_relativistic) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "Boris particle pusher requires Newtonian or SR MHD"
+                  << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      q_over_m = pin->GetOrAddReal("particles","q_over_m",1.0);
+      // code units of SR MHD have c=1, which is also the default otherwise
+      c_light = pin->GetOrAddReal("particles","speed_of_light",1.0);
+      if (c_light <= 0.0 ||
+          (pmy_pack->pcoord->is_special_relativistic && c_light != 1.0)) {
+        std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                  << std::endl << "<particles>/speed_of_light = " << c_light
+                  << " must be positive, and equal to 1 with SR MHD" << std::endl;
+        std::exit(EXIT_FAILURE);
+      }
+      cfl_part = pin->GetOrAddReal("particles","cfl_number",0.5);
+      max_gyrophase = pin->GetOrAddReal("particles","max_gyrophase",0.3);
     } else {
       std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
                 << std::endl << "Particle pusher must be specified in <particles> block"
@@ -76,7 +109,8 @@ Particles::Particles(MeshBlockPack *ppack, ParameterInput *pin) :
     case ParticleType::cosmic_ray:
       {
         int ndim=4;
-        if (pmy_pack->pmesh->three_d) {ndim+=2;}
+        // Boris pusher needs all three velocity components, even in 2D
+        if (pmy_pack->pmesh->three_d || pusher == ParticlesPusher::boris) {ndim+=2;}
         nrdata = ndim;
         nidata = 2;
         break;
@@ -137,4 +171,84 @@ void Particles::CreateParticleTags(ParameterInput *pin) {
   }
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void Particles::RedistributeParticles()
+//! \brief Sets particle arrays from data read from a restart file, or from particles with
+//! updated gids after AMR.  Input arrays are dimensioned (nprtcl,nrdata) and
+//! (nprtcl,nidata), and may contain particles in any MeshBlock.  With MPI, particles are
+//! first sent to the rank that owns their parent MeshBlock, so restarts work with a
+//! different number of ranks.  Must be called by all ranks.
+
+void Particles::RedistributeParticles(HostArray2D<Real> rdata, HostArray2D<int> idata) {
+  Mesh *pm = pmy_pack->pmesh;
+  int npart = rdata.extent_int(0);
+#if MPI_PARALLEL_ENABLED
+  // sort particles by destination rank (counting sort, order within rank is kept)
+  int nranks = global_variable::nranks;
+  std::vector<int> nsend(nranks, 0), nrecv(nranks), sdispl(nranks), rdispl(nranks);
+  for (int p=0; p<npart; ++p) {
+    nsend[pm->rank_eachmb[idata(p,PGID)]]++;
+  }
+  MPI_Alltoall(nsend.data(), 1, MPI_INT, nrecv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  int nrecv_total = 0;
+  for (int n=0; n<nranks; ++n) {
+    sdispl[n] = (n == 0)? 0 : sdispl[n-1] + nsend[n-1];
+    rdispl[n] = nrecv_total;
+    nrecv_total += nrecv[n];
+  }
+  HostArray2D<Real> rsend("rsend", npart, nrdata), rrecv("rrecv", nrecv_total, nrdata);
+  HostArray2D<int>  isend("isend", npart, nidata), irecv("irecv", nrecv_total, nidata);
+  std::vector<int> next(sdispl);
+  for (int p=0; p<npart; ++p) {
+    int q = next[pm->rank_eachmb[idata(p,PGID)]]++;
+    for (int n=0; n<nrdata; ++n) {rsend(q,n) = rdata(p,n);}
+    for (int n=0; n<nidata; ++n) {isend(q,n) = idata(p,n);}
+  }
+
+  // exchange real and integer data, with counts/displacements scaled by number of data
+  std::vector<int> scnt(nranks), sdsp(nranks), rcnt(nranks), rdsp(nranks);
+  for (int n=0; n<nranks; ++n) {
+    scnt[n] = nsend[n]*nrdata;  sdsp[n] = sdispl[n]*nrdata;
+    rcnt[n] = nrecv[n]*nrdata;  rdsp[n] = rdispl[n]*nrdata;
+  }
+  MPI_Alltoallv(rsend.data(), scnt.data(), sdsp.data(), MPI_ATHENA_REAL,
+                rrecv.data(), rcnt.data(), rdsp.data(), MPI_ATHENA_REAL, MPI_COMM_WORLD);
+  for (int n=0; n<nranks; ++n) {
+    scnt[n] = nsend[n]*nidata;  sdsp[n] = sdispl[n]*nidata;
+    rcnt[n] = nrecv[n]*nidata;  rdsp[n] = rdispl[n]*nidata;
+  }
+  MPI_Alltoallv(isend.data(), scnt.data(), sdsp.data(), MPI_INT,
+                irecv.data(), rcnt.data(), rdsp.data(), MPI_INT, MPI_COMM_WORLD);
+  rdata = rrecv;
+  idata = irecv;
+  npart = nrecv_total;
+#endif
+
+  // copy into particle arrays, which are dimensioned (ndata,nprtcl)
+  nprtcl_thispack = npart;
+  Kokkos::realloc(prtcl_rdata, nrdata, nprtcl_thispack);
+  Kokkos::realloc(prtcl_idata, nidata, nprtcl_thispack);
+  auto h_rdata = Kokkos::create_mirror_view(prtcl_rdata);
+  auto h_idata = Kokkos::create_mirror_view(prtcl_idata);
+  for (int p=0; p<npart; ++p) {
+    for (int n=0; n<nrdata; ++n) {h_rdata(n,p) = rdata(p,n);}
+    for (int n=0; n<nidata; ++n) {h_idata(n,p) = idata(p,n);}
+  }
+  Kokkos::deep_copy(prtcl_rdata, h_rdata);
+  Kokkos::deep_copy(prtcl_idata, h_idata);
+
+  // update number of particles on each rank stored in Mesh
+  pm->nprtcl_thisrank = nprtcl_thispack;
+  pm->nprtcl_eachrank[global_variable::my_rank] = nprtcl_thispack;
+#if MPI_PARALLEL_ENABLED
+  MPI_Allgather(&(pm->nprtcl_thisrank), 1, MPI_INT, pm->nprtcl_eachrank, 1, MPI_INT,
+                MPI_COMM_WORLD);
+#endif
+  pm->nprtcl_total = 0;
+  for (int n=0; n<global_variable::nranks; ++n) {
+    pm->nprtcl_total += pm->nprtcl_eachrank[n];
+  }
+  return;
+}
+
 } // namespace particles
@@ -20,7 +20,7 @@
 // forward declarations
 
 // constants that enumerate ParticlesPusher options
-enum class ParticlesPusher {drift, leap_frog, lagrangian_tracer, lagrangian_mc};
+enum class ParticlesPusher {drift, boris, leap_frog, lagrangian_tracer, lagrangian_mc};
 
 // constants that enumerate ParticleTypes
 enum class ParticleType {cosmic_ray};
@@ -38,6 +38,7 @@ struct ParticlesTaskIDs {
   TaskID recvp;
   TaskID csend;
   TaskID crecv;
+  TaskID newdt;
 };
 
 namespace particles {
@@ -64,6 +65,12 @@ class Particles {
 
   ParticlesPusher pusher;
 
+  // parameters of Boris pusher.  Particle velocities are stored as u = gamma*v
+  Real q_over_m;      // charge-to-mass ratio, in units where E = -v_fluid x B
+  Real c_light;       // speed of light in code units
+  Real cfl_part;      // max fraction of a cell crossed by any particle per step
+  Real max_gyrophase; // max gyrophase (in radians) of any particle per step
+
   // Boundary communication buffers and functions for particles
   ParticlesBoundaryValues *pbval_part;
 
@@ -72,8 +79,10 @@ class Particles {
 
   // functions...
   void CreateParticleTags(ParameterInput *pin);
+  void RedistributeParticles(HostArray2D<Real> rdata, HostArray2D<int> idata);
   void AssembleTasks(std::map<std::string, std::shared_ptr<TaskList>> tl);
   TaskStatus Push(Driver *pdriver, int stage);
+  TaskStatus NewTimeStep(Driver *pdriver, int stage);
   TaskStatus NewGID(Driver *pdriver, int stage);
   TaskStatus SendCnt(Driver *pdriver, int stage);
   TaskStatus InitRecv(Driver *pdriver, int stage);
@@ -6,12 +6,131 @@
 //! \file particle_pushers.cpp
 //  \brief
 
+#include <limits>
+
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
+#include "coordinates/coordinates.hpp"
 #include "driver/driver.hpp"
+#include "mhd/mhd.hpp"
 #include "particles.hpp"
 
 namespace particles {
+//----------------------------------------------------------------------------------------
+//! \fn void TrilinearWeights()
+//  \brief Indices of the lower corner of the 2x2x2 cells surrounding position x in a
+//  MeshBlock, and the trilinear weights of the cells.  nj=nk=1 in 1D/2D.
+
+KOKKOS_INLINE_FUNCTION
+void TrilinearWeights(const RegionSize &size, const int is, const int js, const int ks,
+                      const bool multi_d, const bool three_d, const Real x[3],
+                      int &i0, int &j0, int &k0, int &nj, int &nk,
+                      Real wx[2], Real wy[2], Real wz[2]) {
+  Real s1 = (x[0] - size.x1min)/size.dx1 - 0.5;
+  i0 = static_cast<int>(floor(s1));
+  wx[0] = 1.0 - (s1 - i0);
+  wx[1] = s1 - i0;
+  i0 += is;
+  j0 = js;
+  nj = 1;
+  wy[0] = 1.0;
+  wy[1] = 0.0;
+  if (multi_d) {
+    Real s2 = (x[1] - size.x2min)/size.dx2 - 0.5;
+    j0 = static_cast<int>(floor(s2));
+    wy[0] = 1.0 - (s2 - j0);
+    wy[1] = s2 - j0;
+    j0 += js;
+    nj = 2;
+  }
+  k0 = ks;
+  nk = 1;
+  wz[0] = 1.0;
+  wz[1] = 0.0;
+  if (three_d) {
+    Real s3 = (x[2] - size.x3min)/size.dx3 - 0.5;
+    k0 = static_cast<int>(floor(s3));
+    wz[0] = 1.0 - (s3 - k0);
+    wz[1] = s3 - k0;
+    k0 += ks;
+    nk = 2;
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void InterpolateFields()
+//  \brief Trilinear interpolation of the cell-centered magnetic field, and of the
+//  electric field from ideal Ohm's law E = -v x B, to position x in MeshBlock m.  E is
+//  computed in each cell before it is interpolated.  With SR MHD, w0 stores u = gamma*v.
+
+KOKKOS_INLINE_FUNCTION
+void InterpolateFields(const DvceArray5D<Real> &w0, const DvceArray5D<Real> &bcc0,
+                       const RegionSize &size, const int m, const int is, const int js,
+                       const int ks, const bool multi_d, const bool three_d,
+                       const bool is_sr, const Real x[3], Real b[3], Real e[3]) {
+  int i0, j0, k0, nj, nk;
+  Real wx[2], wy[2], wz[2];
+  TrilinearWeights(size, is, js, ks, multi_d, three_d, x, i0, j0, k0, nj, nk, wx, wy, wz);
+
+  for (int n=0; n<3; ++n) {
+    b[n] = 0.0;
+    e[n] = 0.0;
+  }
+  for (int c=0; c<nk; ++c) {
+    for (int bb=0; bb<nj; ++bb) {
+      for (int a=0; a<2; ++a) {
+        int k = k0 + c, j = j0 + bb, i = i0 + a;
+        Real wght = wz[c]*wy[bb]*wx[a];
+        Real bc[3] = {bcc0(m,IBX,k,j,i), bcc0(m,IBY,k,j,i), bcc0(m,IBZ,k,j,i)};
+        Real vc[3] = {w0(m,IVX,k,j,i), w0(m,IVY,k,j,i), w0(m,IVZ,k,j,i)};
+        if (is_sr) {
+          Real lor = sqrt(1.0 + SQR(vc[0]) + SQR(vc[1]) + SQR(vc[2]));
+          for (int n=0; n<3; ++n) {vc[n] /= lor;}
+        }
+        b[0] += wght*bc[0];
+        b[1] += wght*bc[1];
+        b[2] += wght*bc[2];
+        e[0] -= wght*(vc[1]*bc[2] - vc[2]*bc[1]);
+        e[1] -= wght*(vc[2]*bc[0] - vc[0]*bc[2]);
+        e[2] -= wght*(vc[0]*bc[1] - vc[1]*bc[0]);
+      }
+    }
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void InterpolateBField()
+//  \brief Trilinear interpolation of the cell-centered magnetic field only, to position
+//  x in MeshBlock m.  Used where E is not needed, e.g. for the gyrofrequency.
+
+KOKKOS_INLINE_FUNCTION
+void InterpolateBField(const DvceArray5D<Real> &bcc0, const RegionSize &size,
+                       const int m, const int is, const int js, const int ks,
+                       const bool multi_d, const bool three_d, const Real x[3],
+                       Real b[3]) {
+  int i0, j0, k0, nj, nk;
+  Real wx[2], wy[2], wz[2];
+  TrilinearWeights(size, is, js, ks, multi_d, three_d, x, i0, j0, k0, nj, nk, wx, wy, wz);
+
+  for (int n=0; n<3; ++n) {
+    b[n] = 0.0;
+  }
+  for (int c=0; c<nk; ++c) {
+    for (int bb=0; bb<nj; ++bb) {
+      for (int a=0; a<2; ++a) {
+        int k = k0 + c, j = j0 + bb, i = i0 + a;
+        Real wght = wz[c]*wy[bb]*wx[a];
+        b[0] += wght*bcc0(m,IBX,k,j,i);
+        b[1] += wght*bcc0(m,IBY,k,j,i);
+        b[2] += wght*bcc0(m,IBZ,k,j,i);
+      }
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void Particles::ParticlesPush
 //  \brief
@@ -50,10 +169,107 @@ TaskStatus Particles::Push(Driver *pdriver, int stage) {
       });
 
     break;
+
+    // Relativistic Boris push of u = gamma*v, in kick-drift form: a half-step drift to
+    // the time-centered position, where the fields are interpolated, a full-step Boris
+    // rotation and electric kick, then a second half-step drift with the new velocity.
+    case ParticlesPusher::boris:
+    {
+      auto &w0_ = pmy_pack->pmhd->w0;
+      auto &bcc0_ = pmy_pack->pmhd->bcc0;
+      bool is_sr = pmy_pack->pcoord->is_special_relativistic;
+      Real hqm = 0.5*q_over_m*dt_;
+      Real ic2 = 1.0/SQR(c_light);
+
+      par_for("part_boris",DevExeSpace(),0,(nprtcl_thispack-1),
+      KOKKOS_LAMBDA(const int p) {
+        int m = pi(PGID,p) - gids;
+        Real u[3] = {pr(IPVX,p), pr(IPVY,p), pr(IPVZ,p)};
+        Real ig = 1.0/sqrt(1.0 + (SQR(u[0]) + SQR(u[1]) + SQR(u[2]))*ic2);
+        Real x[3] = {pr(IPX,p) + 0.5*dt_*u[0]*ig, pr(IPY,p), pr(IPZ,p)};
+        if (multi_d) {x[1] += 0.5*dt_*u[1]*ig;}
+        if (three_d) {x[2] += 0.5*dt_*u[2]*ig;}
+
+        Real b[3], e[3];
+        InterpolateFields(w0_, bcc0_, mbsize.d_view(m), m, is, js, ks, multi_d, three_d,
+                          is_sr, x, b, e);
+
+        // first half of electric kick
+        for (int n=0; n<3; ++n) {u[n] += hqm*e[n];}
+        // magnetic rotation
+        ig = 1.0/sqrt(1.0 + (SQR(u[0]) + SQR(u[1]) + SQR(u[2]))*ic2);
+        Real t[3] = {hqm*b[0]*ig, hqm*b[1]*ig, hqm*b[2]*ig};
+        Real sfac = 2.0/(1.0 + SQR(t[0]) + SQR(t[1]) + SQR(t[2]));
+        Real up[3] = {u[0] + u[1]*t[2] - u[2]*t[1],
+                      u[1] + u[2]*t[0] - u[0]*t[2],
+                      u[2] + u[0]*t[1] - u[1]*t[0]};
+        u[0] += sfac*(up[1]*t[2] - up[2]*t[1]);
+        u[1] += sfac*(up[2]*t[0] - up[0]*t[2]);
+        u[2] += sfac*(up[0]*t[1] - up[1]*t[0]);
+        // second half of electric kick
+        for (int n=0; n<3; ++n) {u[n] += hqm*e[n];}
+
+        ig = 1.0/sqrt(1.0 + (SQR(u[0]) + SQR(u[1]) + SQR(u[2]))*ic2);
+        pr(IPX,p) = x[0] + 0.5*dt_*u[0]*ig;
+        if (multi_d) {pr(IPY,p) = x[1] + 0.5*dt_*u[1]*ig;}
+        if (three_d) {pr(IPZ,p) = x[2] + 0.5*dt_*u[2]*ig;}
+        pr(IPVX,p) = u[0];
+        pr(IPVY,p) = u[1];
+        pr(IPVZ,p) = u[2];
+      });
+    }
+    break;
   default:
     break;
   }
 
   return TaskStatus::complete;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn  void Particles::NewTimeStep
+//  \brief Computes new timestep for particles pushed by the Boris integrator: no particle
+//  may cross more than cfl_number cells, or advance by more than max_gyrophase radians
+//  around its gyro-orbit, per step.  With other pushers dtnew is set by the pgen.
+
+TaskStatus Particles::NewTimeStep(Driver *pdriver, int stage) {
+  if (pusher != ParticlesPusher::boris) {
+    return TaskStatus::complete;
+  }
+
+  auto &indcs = pmy_pack->pmesh->mb_indcs;
+  int is = indcs.is, js = indcs.js, ks = indcs.ks;
+  bool &multi_d = pmy_pack->pmesh->multi_d;
+  bool &three_d = pmy_pack->pmesh->three_d;
+  auto &mbsize = pmy_pack->pmb->mb_size;
+  auto &pi = prtcl_idata;
+  auto &pr = prtcl_rdata;
+  auto gids = pmy_pack->gids;
+  auto &bcc0_ = pmy_pack->pmhd->bcc0;
+  Real qm = fabs(q_over_m);
+  Real ic2 = 1.0/SQR(c_light);
+  Real cfl = cfl_part;
+  Real dphi = max_gyrophase;
+
+  Real dtmin = std::numeric_limits<float>::max();
+  Kokkos::parallel_reduce("part_newdt",Kokkos::RangePolicy<>(DevExeSpace(), 0,
+                          nprtcl_thispack),
+  KOKKOS_LAMBDA(const int &p, Real &min_dt) {
+    int m = pi(PGID,p) - gids;
+    Real u[3] = {pr(IPVX,p), pr(IPVY,p), pr(IPVZ,p)};
+    Real ig = 1.0/sqrt(1.0 + (SQR(u[0]) + SQR(u[1]) + SQR(u[2]))*ic2);
+    min_dt = fmin(cfl*mbsize.d_view(m).dx1/fabs(u[0]*ig), min_dt);
+    if (multi_d) {min_dt = fmin(cfl*mbsize.d_view(m).dx2/fabs(u[1]*ig), min_dt);}
+    if (three_d) {min_dt = fmin(cfl*mbsize.d_view(m).dx3/fabs(u[2]*ig), min_dt);}
+
+    Real x[3] = {pr(IPX,p), pr(IPY,p), pr(IPZ,p)};
+    Real b[3];
+    InterpolateBField(bcc0_, mbsize.d_view(m), m, is, js, ks, multi_d, three_d, x, b);
+    Real omega = qm*sqrt(SQR(b[0]) + SQR(b[1]) + SQR(b[2]))*ig;
+    min_dt = fmin(dphi/omega, min_dt);
+  }, Kokkos::Min<Real>(dtmin));
+
+  dtnew = dtmin;
+  return TaskStatus::complete;
+}
 } // namespace particles
@@ -29,14 +29,24 @@ void Particles::AssembleTasks(std::map<std::string, std::shared_ptr<TaskList>> t
   TaskID none(0);
 
   // particle integration done in "before_timeintegrator" task list
-  id.push   = tl["before_timeintegrator"]->AddTask(&Particles::Push, this, none);
-  id.newgid = tl["before_timeintegrator"]->AddTask(&Particles::NewGID, this, id.push);
-  id.count  = tl["before_timeintegrator"]->AddTask(&Particles::SendCnt, this, id.newgid);
-  id.irecv  = tl["before_timeintegrator"]->AddTask(&Particles::InitRecv, this, id.count);
-  id.sendp  = tl["before_timeintegrator"]->AddTask(&Particles::SendP, this, id.irecv);
-  id.recvp  = tl["before_timeintegrator"]->AddTask(&Particles::RecvP, this, id.sendp);
-  id.crecv  = tl["before_timeintegrator"]->AddTask(&Particles::ClearRecv, this, id.recvp);
-  id.csend  = tl["before_timeintegrator"]->AddTask(&Particles::ClearSend, this, id.crecv);
+  id.push   = tl["before_timeintegrator"]->AddTask(&Particles::Push, this, none,
+                                                   "Particles::Push");
+  id.newgid = tl["before_timeintegrator"]->AddTask(&Particles::NewGID, this, id.push,
+                                                   "Particles::NewGID");
+  id.count  = tl["before_timeintegrator"]->AddTask(&Particles::SendCnt, this, id.newgid,
+                                                   "Particles::SendCnt");
+  id.irecv  = tl["before_timeintegrator"]->AddTask(&Particles::InitRecv, this, id.count,
+                                                   "Particles::InitRecv");
+  id.sendp  = tl["before_timeintegrator"]->AddTask(&Particles::SendP, this, id.irecv,
+                                                   "Particles::SendP");
+  id.recvp  = tl["before_timeintegrator"]->AddTask(&Particles::RecvP, this, id.sendp,
+                                                   "Particles::RecvP");
+  id.crecv  = tl["before_timeintegrator"]->AddTask(&Particles::ClearRecv, this, id.recvp,
+                                                   "Particles::ClearRecv");
+  id.csend  = tl["before_timeintegrator"]->AddTask(&Particles::ClearSend, this, id.crecv,
+                                                   "Particles::ClearSend");
+  id.newdt  = tl["before_timeintegrator"]->AddTask(&Particles::NewTimeStep, this,
+                                                   id.csend, "Particles::NewTimeStep");
 
   return;
 }
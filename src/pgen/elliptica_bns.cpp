@@ -10,15 +10,18 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <array>
 #include <iostream>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/adm.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "z4c/compact_object_tracker.hpp"
 #include "coordinates/coordinates.hpp"
 #include "coordinates/cell_locations.hpp"
 #include "dyn_grmhd/dyn_grmhd.hpp"
@@ -29,6 +32,7 @@
 #include "mesh/mesh.hpp"
 #include "mhd/mhd.hpp"
 #include "parameter_input.hpp"
+#include "utils/sampled_id.hpp"
 
 void EllipticaBNSHistory(HistoryData *pdata, Mesh *pm);
 void EllipticaBNSRefinementCondition(MeshBlockPack *pmbp);
@@ -84,7 +88,19 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   int ncells3 = indcs.nx3 + 2 * (indcs.ng);
   int nmb     = pmbp->nmb_thispack;
 
+  // With <problem>/id_sample_npts > 0, Elliptica is only called at the sample points
+  // assigned to this rank, which are then interpolated to the mesh on the device.
+  // The finer sample boxes are centered on the stars, as given by the trackers.
+  std::vector<std::array<Real, 3>> stars;
+  for (auto &ptracker : pmbp->pz4c->ptracker) {
+    stars.push_back({ptracker->GetPos(0), ptracker->GetPos(1), ptracker->GetPos(2)});
+  }
+  SampledInitialData sid(pin, pmy_mesh_, 21, stars);
+
   int width = nmb * ncells1 * ncells2 * ncells3;
+  if (sid.enabled) {
+    width = sid.pend - sid.pbeg;
+  }
 
   Real *x_coords = new Real[width];
   Real *y_coords = new Real[width];
@@ -96,7 +112,13 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   // TODO(JMF): Replace with a Kokkos loop on
   // Kokkos::DefaultHostExecutionSpace() to improve performance.
   int idx = 0;
-  for (int m = 0; m < nmb; m++) {
+  if (sid.enabled) {
+    for (int p = sid.pbeg; p < sid.pend; p++) {
+      sid.SampleCoordinates(p, x_coords[idx], y_coords[idx], z_coords[idx]);
+      idx++;
+    }
+  }
+  for (int m = 0; m < nmb && !sid.enabled; m++) {
     Real &x1min = size.h_view(m).x1min;
     Real &x1max = size.h_view(m).x1max;
     int nx1     = indcs.nx1;
@@ -198,6 +220,37 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
   std::cout << "Label indices saved." << std::endl;
 
+  // Fields at all cells, in the order [m,k,j,i].  Taken directly from Elliptica, or
+  // interpolated from the samples.
+  const int ifld[21] = {i_alpha, i_betax, i_betay, i_betaz,
+                        i_gxx, i_gxy, i_gxz, i_gyy, i_gyz, i_gzz,
+                        i_Kxx, i_Kxy, i_Kxz, i_Kyy, i_Kyz, i_Kzz,
+                        i_rho, i_p, i_vx, i_vy, i_vz};
+  std::vector<Real *> field(1 + *std::max_element(ifld, ifld + 21));
+  DvceArray5D<Real> id_vals;
+  HostArray5D<Real>::HostMirror host_id_vals;
+  if (sid.enabled) {
+    for (int n = 0; n < 21; n++) {
+      for (int p = sid.pbeg; p < sid.pend; p++) {
+        sid.values(n, p - sid.pbeg) = idr->field[ifld[n]][p - sid.pbeg];
+      }
+    }
+    // hydro fields i_rho,...,i_vz
+    for (int n = 16; n < 21; n++) {
+      sid.limit.h_view(n) = 1;
+    }
+    sid.Gather();
+    sid.InterpolateToMesh(pmbp, id_vals);
+    host_id_vals = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), id_vals);
+    for (int n = 0; n < 21; n++) {
+      field[ifld[n]] = &(host_id_vals(n, 0, 0, 0, 0));
+    }
+  } else {
+    for (int n = 0; n < 21; n++) {
+      field[ifld[n]] = idr->field[ifld[n]];
+    }
+  }
+
   // TODO(JMF): Replace with a Kokkos loop on
   // Kokkos::DefaultHostExecutionSpace() to improve performance.
   idx = 0;
@@ -206,32 +259,32 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
       for (int j = 0; j < ncells2; j++) {
         for (int i = 0; i < ncells1; i++) {
           // Extract metric quantities
-          host_adm.alpha(m, k, j, i)     = idr->field[i_alpha][idx];
-          host_adm.beta_u(m, 0, k, j, i) = idr->field[i_betax][idx];
-          host_adm.beta_u(m, 1, k, j, i) = idr->field[i_betay][idx];
-          host_adm.beta_u(m, 2, k, j, i) = idr->field[i_betaz][idx];
+          host_adm.alpha(m, k, j, i)     = field[i_alpha][idx];
+          host_adm.beta_u(m, 0, k, j, i) = field[i_betax][idx];
+          host_adm.beta_u(m, 1, k, j, i) = field[i_betay][idx];
+          host_adm.beta_u(m, 2, k, j, i) = field[i_betaz][idx];
 
           Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = idr->field[i_gxx][idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = idr->field[i_gxy][idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = idr->field[i_gxz][idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = idr->field[i_gyy][idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = idr->field[i_gyz][idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = idr->field[i_gzz][idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = idr->field[i_Kxx][idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = idr->field[i_Kxy][idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = idr->field[i_Kxz][idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = idr->field[i_Kyy][idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = idr->field[i_Kyz][idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = idr->field[i_Kzz][idx];
+          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = field[i_gxx][idx];
+          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = field[i_gxy][idx];
+          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = field[i_gxz][idx];
+          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = field[i_gyy][idx];
+          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = field[i_gyz][idx];
+          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = field[i_gzz][idx];
+
+          host_adm.vK_dd(m, 0, 0, k, j, i) = field[i_Kxx][idx];
+          host_adm.vK_dd(m, 0, 1, k, j, i) = field[i_Kxy][idx];
+          host_adm.vK_dd(m, 0, 2, k, j, i) = field[i_Kxz][idx];
+          host_adm.vK_dd(m, 1, 1, k, j, i) = field[i_Kyy][idx];
+          host_adm.vK_dd(m, 1, 2, k, j, i) = field[i_Kyz][idx];
+          host_adm.vK_dd(m, 2, 2, k, j, i) = field[i_Kzz][idx];
 
           // Extract hydro quantities
-          host_w0(m, IDN, k, j, i) = idr->field[i_rho][idx];
-          host_w0(m, IPR, k, j, i) = idr->field[i_p][idx];
+          host_w0(m, IDN, k, j, i) = field[i_rho][idx];
+          host_w0(m, IPR, k, j, i) = field[i_p][idx];
           Real vu[3]               = {
-            idr->field[i_vx][idx], idr->field[i_vy][idx],
-            idr->field[i_vz][idx]};
+            field[i_vx][idx], field[i_vy][idx],
+            field[i_vz][idx]};
 
           // Before we store the velocity, we need to make sure it's physical
           // and calculate the Lorentz factor. If the velocity is superluminal,
@@ -43,6 +43,7 @@
 #include "hydro/hydro.hpp"
 #include "mhd/mhd.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation/radiation_tetrad.hpp"
 #include "dyn_grmhd/dyn_grmhd.hpp"
 
 #include <Kokkos_Random.hpp>
@@ -194,14 +195,10 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   // Extract radiation parameters if enabled
   int nangles_;
   DualArray2D<Real> nh_c_;
-  DvceArray6D<Real> norm_to_tet_, tet_c_, tetcov_c_;
   DvceArray5D<Real> i0_;
   if (is_radiation_enabled) {
     nangles_ = pmbp->prad->prgeo->nangles;
     nh_c_ = pmbp->prad->nh_c;
-    norm_to_tet_ = pmbp->prad->norm_to_tet;
-    tet_c_ = pmbp->prad->tet_c;
-    tetcov_c_ = pmbp->prad->tetcov_c;
     i0_ = pmbp->prad->i0;
   }
 
@@ -433,15 +430,17 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
              + glower[2][2]*uu2*uu2 + 2.0*glower[2][3]*uu2*uu3
              + glower[3][3]*uu3*uu3;
       Real uu0 = sqrt(1.0 + q);
+
+      // tetrad (evaluated here since stored tetrads are absent with tetrad_on_the_fly)
+      Real e[4][4], ecov[4][4], ntt[4][4];
+      ComputeTetradComponents(x1v,x2v,x3v,coord.is_minkowski,coord.bh_spin,e);
+      ComputeNormToTetrad(e,glower,gupper,ecov,ntt);
+
       Real u_tet_[4];
-      u_tet_[0] = (norm_to_tet_(m,0,0,k,j,i)*uu0 + norm_to_tet_(m,0,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,0,2,k,j,i)*uu2 + norm_to_tet_(m,0,3,k,j,i)*uu3);
-      u_tet_[1] = (norm_to_tet_(m,1,0,k,j,i)*uu0 + norm_to_tet_(m,1,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,1,2,k,j,i)*uu2 + norm_to_tet_(m,1,3,k,j,i)*uu3);
-      u_tet_[2] = (norm_to_tet_(m,2,0,k,j,i)*uu0 + norm_to_tet_(m,2,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,2,2,k,j,i)*uu2 + norm_to_tet_(m,2,3,k,j,i)*uu3);
-      u_tet_[3] = (norm_to_tet_(m,3,0,k,j,i)*uu0 + norm_to_tet_(m,3,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,3,2,k,j,i)*uu2 + norm_to_tet_(m,3,3,k,j,i)*uu3);
+      u_tet_[0] = (ntt[0][0]*uu0 + ntt[0][1]*uu1 + ntt[0][2]*uu2 + ntt[0][3]*uu3);
+      u_tet_[1] = (ntt[1][0]*uu0 + ntt[1][1]*uu1 + ntt[1][2]*uu2 + ntt[1][3]*uu3);
+      u_tet_[2] = (ntt[2][0]*uu0 + ntt[2][1]*uu1 + ntt[2][2]*uu2 + ntt[2][3]*uu3);
+      u_tet_[3] = (ntt[3][0]*uu0 + ntt[3][1]*uu1 + ntt[3][2]*uu2 + ntt[3][3]*uu3);
 
       // Go through each angle
       for (int n=0; n<nangles_; ++n) {
@@ -451,8 +450,8 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
         Real n0_f = u_tet_[0]*nh_c_.d_view(n,0) - un_t;
 
         // Calculate intensity in tetrad frame
-        Real n0 = tet_c_(m,0,0,k,j,i); Real n_0 = 0.0;
-        for (int d=0; d<4; ++d) {  n_0 += tetcov_c_(m,d,0,k,j,i)*nh_c_.d_view(n,d);  }
+        Real n0 = e[0][0]; Real n_0 = 0.0;
+        for (int d=0; d<4; ++d) {  n_0 += ecov[d][0]*nh_c_.d_view(n,d);  }
         i0_(m,n,k,j,i) = n0*n_0*(urad/(4.0*M_PI))/SQR(SQR(n0_f));
       }
     }
@@ -12,10 +12,12 @@
 #include <math.h>
 
 #include <algorithm>
+#include <array>
 #include <limits>
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -24,6 +26,7 @@
 #include "coordinates/adm.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
+#include "z4c/compact_object_tracker.hpp"
 #include "coordinates/coordinates.hpp"
 #include "coordinates/cell_locations.hpp"
 #include "eos/eos.hpp"
@@ -34,6 +37,7 @@
 #include "utils/tov/tov_polytrope.hpp"
 #include "utils/tov/tov_piecewise_poly.hpp"
 #include "utils/tov/tov_tabulated.hpp"
+#include "utils/sampled_id.hpp"
 
 // Lorene
 #include "bin_ns.h"
@@ -90,7 +94,21 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
   int ncells3 = indcs.nx3 + 2*(indcs.ng);
   int nmb = pmbp->nmb_thispack;
 
+  // With <problem>/id_sample_npts > 0, Lorene is only called at the sample points
+  // assigned to this rank, which are then interpolated to the mesh on the device.
+  // The finer sample boxes are centered on the stars, as given by the trackers.
+  std::vector<std::array<Real,3>> stars;
+  if (pmbp->pz4c != nullptr) {
+    for (auto &ptracker : pmbp->pz4c->ptracker) {
+      stars.push_back({ptracker->GetPos(0), ptracker->GetPos(1), ptracker->GetPos(2)});
+    }
+  }
+  SampledInitialData sid(pin, pmy_mesh_, 21, stars);
+
   int width = nmb*ncells1*ncells2*ncells3;
+  if (sid.enabled) {
+    width = sid.pend - sid.pbeg;
+  }
 
   Real *x_coords = new Real[width];
   Real *y_coords = new Real[width];
@@ -108,7 +126,17 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
 
   // Populate coordinates for LORENE
   int idx = 0;
-  for (int m = 0; m < nmb; m++) {
+  if (sid.enabled) {
+    for (int p = sid.pbeg; p < sid.pend; p++) {
+      Real x, y, z;
+      sid.SampleCoordinates(p, x, y, z);
+      x_coords[idx] = coord_unit*x;
+      y_coords[idx] = coord_unit*y;
+      z_coords[idx] = coord_unit*z;
+      idx++;
+    }
+  }
+  for (int m = 0; m < nmb && !sid.enabled; m++) {
     Real &x1min = size.h_view(m).x1min;
     Real &x1max = size.h_view(m).x1max;
     int nx1 = indcs.nx1;
@@ -186,6 +214,34 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
     std::cout << "Host mirrors created." << std::endl;
   }
 
+  // Lorene fields at all cells, in the order [m,k,j,i].  Taken directly from Lorene, or
+  // interpolated from the samples.
+  enum {I_N, I_BX, I_BY, I_BZ, I_GXX, I_GXY, I_GXZ, I_GYY, I_GYZ, I_GZZ,
+        I_KXX, I_KXY, I_KXZ, I_KYY, I_KYZ, I_KZZ, I_NBAR, I_EPS, I_UX, I_UY, I_UZ};
+  Real *lfld[I_UZ+1] = {bns->nnn, bns->beta_x, bns->beta_y, bns->beta_z,
+                        bns->g_xx, bns->g_xy, bns->g_xz, bns->g_yy, bns->g_yz, bns->g_zz,
+                        bns->k_xx, bns->k_xy, bns->k_xz, bns->k_yy, bns->k_yz, bns->k_zz,
+                        bns->nbar, bns->ener_spec,
+                        bns->u_euler_x, bns->u_euler_y, bns->u_euler_z};
+  DvceArray5D<Real> id_vals;
+  HostArray5D<Real>::HostMirror host_id_vals;
+  if (sid.enabled) {
+    for (int n = 0; n <= I_UZ; n++) {
+      for (int p = sid.pbeg; p < sid.pend; p++) {
+        sid.values(n, p - sid.pbeg) = lfld[n][p - sid.pbeg];
+      }
+    }
+    for (int n = I_NBAR; n <= I_UZ; n++) {
+      sid.limit.h_view(n) = 1;
+    }
+    sid.Gather();
+    sid.InterpolateToMesh(pmbp, id_vals);
+    host_id_vals = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), id_vals);
+    for (int n = 0; n <= I_UZ; n++) {
+      lfld[n] = &(host_id_vals(n, 0, 0, 0, 0));
+    }
+  }
+
   // Copy the interpolated data into the mirrored views.
   idx = 0;
   for (int m = 0; m < nmb; m++) {
@@ -193,36 +249,36 @@ void SetupBNS(ParameterInput *pin, Mesh* pmy_mesh_) {
       for (int j = 0; j < ncells2; j++) {
         for (int i = 0; i < ncells1; i++) {
           // Extract metric quantities
-          host_adm.alpha(m, k, j, i) = bns->nnn[idx];
-          host_adm.beta_u(m, 0, k, j, i) = bns->beta_x[idx];
-          host_adm.beta_u(m, 1, k, j, i) = bns->beta_y[idx];
-          host_adm.beta_u(m, 2, k, j, i) = bns->beta_z[idx];
+          host_adm.alpha(m, k, j, i) = lfld[I_N][idx];
+          host_adm.beta_u(m, 0, k, j, i) = lfld[I_BX][idx];
+          host_adm.beta_u(m, 1, k, j, i) = lfld[I_BY][idx];
+          host_adm.beta_u(m, 2, k, j, i) = lfld[I_BZ][idx];
 
           Real g3d[NSPMETRIC];
-          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = bns->g_xx[idx];
-          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = bns->g_xy[idx];
-          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = bns->g_xz[idx];
-          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = bns->g_yy[idx];
-          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = bns->g_yz[idx];
-          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = bns->g_zz[idx];
-
-          host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * bns->k_xx[idx];
-          host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * bns->k_xy[idx];
-          host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * bns->k_xz[idx];
-          host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * bns->k_yy[idx];
-          host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * bns->k_yz[idx];
-          host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * bns->k_zz[idx];
+          host_adm.g_dd(m, 0, 0, k, j, i) = g3d[S11] = lfld[I_GXX][idx];
+          host_adm.g_dd(m, 0, 1, k, j, i) = g3d[S12] = lfld[I_GXY][idx];
+          host_adm.g_dd(m, 0, 2, k, j, i) = g3d[S13] = lfld[I_GXZ][idx];
+          host_adm.g_dd(m, 1, 1, k, j, i) = g3d[S22] = lfld[I_GYY][idx];
+          host_adm.g_dd(m, 1, 2, k, j, i) = g3d[S23] = lfld[I_GYZ][idx];
+          host_adm.g_dd(m, 2, 2, k, j, i) = g3d[S33] = lfld[I_GZZ][idx];
+
+          host_adm.vK_dd(m, 0, 0, k, j, i) = coord_unit * lfld[I_KXX][idx];
+          host_adm.vK_dd(m, 0, 1, k, j, i) = coord_unit * lfld[I_KXY][idx];
+          host_adm.vK_dd(m, 0, 2, k, j, i) = coord_unit * lfld[I_KXZ][idx];
+          host_adm.vK_dd(m, 1, 1, k, j, i) = coord_unit * lfld[I_KYY][idx];
+          host_adm.vK_dd(m, 1, 2, k, j, i) = coord_unit * lfld[I_KYZ][idx];
+          host_adm.vK_dd(m, 2, 2, k, j, i) = coord_unit * lfld[I_KZZ][idx];
 
           // Extract hydro quantities
           // Note that Lorene does not necessarily use the same baryon rest-mass as
           // AthenaK. The most reasonable thing to do, then, is to extract the total
           // energy density, which is invariant, and use that with the 1D EOS.
-          Real egas = bns->nbar[idx]*(1.0 + bns->ener_spec[idx] / ener_unit)/rho_unit;
+          Real egas = lfld[I_NBAR][idx]*(1.0 + lfld[I_EPS][idx] / ener_unit)/rho_unit;
           Real& rho = host_w0(m, IDN, k, j, i);
           rho = eos.template GetRhoFromE<tov::LocationTag::Host>(egas);
-          Real vu[3] = {bns->u_euler_x[idx] / vel_unit,
-                        bns->u_euler_y[idx] / vel_unit,
-                        bns->u_euler_z[idx] / vel_unit};
+          Real vu[3] = {lfld[I_UX][idx] / vel_unit,
+                        lfld[I_UY][idx] / vel_unit,
+                        lfld[I_UZ][idx] / vel_unit};
 
           // Check for garbage values thrown in by Lorene.
           if (rho <= rho_cut || !Kokkos::isfinite(rho)) {
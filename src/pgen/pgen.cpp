@@ -27,6 +27,7 @@
 #include "z4c/z4c.hpp"
 #include "radiation/radiation.hpp"
 #include "srcterms/turb_driver.hpp"
+#include "particles/particles.hpp"
 #include "pgen.hpp"
 
 
@@ -615,6 +616,69 @@ ProblemGenerator::ProblemGenerator(ParameterInput *pin, Mesh *pm, IOWrapper resf
     myoffset = offset_myrank;
   }
 
+  // read particles.  Each rank reads an equal share of the particles in the file, which
+  // are then sent to the rank that owns their parent MeshBlock, so that the number of
+  // ranks may differ from that used to write the restart file.
+  particles::Particles* ppart = pm->pmb_pack->ppart;
+  if (ppart != nullptr) {
+    IOWrapperSizeT part_offset = headeroffset;
+    if (single_file_per_rank) {
+      part_offset += data_size*(pm->nmb_thisrank);
+    } else {
+      part_offset += data_size*(pm->nmb_total);
+    }
+    IOWrapperSizeT npart_total;
+    int ndata[2];
+    if (resfile.Read_bytes_at_all(&npart_total, sizeof(IOWrapperSizeT), 1, part_offset,
+                                  single_file_per_rank) != 1 ||
+        resfile.Read_bytes_at_all(&ndata[0], sizeof(int), 2,
+                                  part_offset + sizeof(IOWrapperSizeT),
+                                  single_file_per_rank) != 2) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Particle data not found in rst file, restart file is "
+                << "broken or was written without particles." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    int nrdata = ndata[0], nidata = ndata[1];
+    if (nrdata != ppart->nrdata || nidata != ppart->nidata) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Number of particle properties in rst file not equal "
+                << "to that of particle type in input file." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    part_offset += sizeof(IOWrapperSizeT) + 2*sizeof(int);
+
+    IOWrapperSizeT pbeg = 0, pend = npart_total;
+    if (!single_file_per_rank) {
+      IOWrapperSizeT nranks = global_variable::nranks;
+      IOWrapperSizeT myrank = global_variable::my_rank;
+      pbeg = (myrank*npart_total)/nranks;
+      pend = ((myrank + 1)*npart_total)/nranks;
+    }
+    int npart = static_cast<int>(pend - pbeg);
+    HostArray2D<Real> rdata("rst-prtcl-rin", npart, nrdata);
+    HostArray2D<int>  idata("rst-prtcl-iin", npart, nidata);
+    IOWrapperSizeT cnt = static_cast<IOWrapperSizeT>(npart)*nrdata;
+    myoffset = part_offset + pbeg*nrdata*sizeof(Real);
+    if (resfile.Read_Reals_at_all(rdata.data(), cnt, myoffset, single_file_per_rank)
+        != cnt) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Particle real data not read correctly from rst file, "
+                << "restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    cnt = static_cast<IOWrapperSizeT>(npart)*nidata;
+    myoffset = part_offset + npart_total*nrdata*sizeof(Real) + pbeg*nidata*sizeof(int);
+    if (resfile.Read_bytes_at_all(idata.data(), sizeof(int), cnt, myoffset,
+                                  single_file_per_rank) != cnt) {
+      std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+                << std::endl << "Particle integer data not read correctly from rst "
+                << "file, restart file is broken." << std::endl;
+      exit(EXIT_FAILURE);
+    }
+    ppart->RedistributeParticles(rdata, idata);
+  }
+
   // call problem generator again to re-initialize data, fn ptrs, as needed
   // second argument true since this IS a restart
   CallProblemGenerator(pin, true);
@@ -911,10 +975,14 @@ void ProblemGenerator::CallProblemGenerator(ParameterInput *pin, bool is_restart
     MRI3d(pin, is_restart);
   } else if (pgen_fun_name.compare("orszag_tang") == 0) {
     OrszagTang(pin, is_restart);
+  } else if (pgen_fun_name.compare("part_gyration") == 0) {
+    ParticleGyration(pin, is_restart);
   } else if (pgen_fun_name.compare("rad_linear_wave") == 0) {
     RadiationLinearWave(pin, is_restart);
   } else if (pgen_fun_name.compare("rad_beam") == 0) {
     RadiationBeam(pin, is_restart);
+  } else if (pgen_fun_name.compare("random_particles") == 0) {
+    RandomParticles(pin, is_restart);
   } else if (pgen_fun_name.compare("shock_tube") == 0) {
     ShockTube(pin, is_restart);
   } else if (pgen_fun_name.compare("shwave") == 0) {
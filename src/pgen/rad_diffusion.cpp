@@ -77,9 +77,8 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   pmbp->phydro->peos->PrimToCons(w0, u0, 0, (n1-1), 0, (n2-1), 0, (n3-1));
 
   auto &nh_c_ = pmbp->prad->nh_c;
-  auto &norm_to_tet_ = pmbp->prad->norm_to_tet;
-  auto &tet_c_ = pmbp->prad->tet_c;
-  auto &tetcov_c_ = pmbp->prad->tetcov_c;
+  auto &flat = pmbp->pcoord->coord_data.is_minkowski;
+  auto &spin = pmbp->pcoord->coord_data.bh_spin;
 
   auto &i0 = pmbp->prad->i0;
   par_for("pgen_diffusion2",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
@@ -100,6 +99,10 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     int nx3 = indcs.nx3;
     Real x3v = CellCenterX(k-ks, nx3, x3min, x3max);
 
+    // tetrad (evaluated here since stored tetrads are absent with tetrad_on_the_fly)
+    Real e[4][4], ecov[4][4], ntt[4][4];
+    ComputeCellTetrad(x1v,x2v,x3v,flat,spin,e,ecov,ntt);
+
     // energy density and flux
     // NOTE(@pdmullen): there is some subtelty here. We need to find the energy density er
     // and flux fr in the comoving frame to pass to @c-white's Minerbo function...but the
@@ -130,10 +133,10 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
     // Compute fluid velocity in tetrad frame
     Real u_tet_[4];
-    u_tet_[0] = (norm_to_tet_(m,0,0,k,j,i)*uu0 + norm_to_tet_(m,0,1,k,j,i)*uu1);
-    u_tet_[1] = (norm_to_tet_(m,1,0,k,j,i)*uu0 + norm_to_tet_(m,1,1,k,j,i)*uu1);
-    u_tet_[2] = (norm_to_tet_(m,2,0,k,j,i)*uu0 + norm_to_tet_(m,2,1,k,j,i)*uu1);
-    u_tet_[3] = (norm_to_tet_(m,3,0,k,j,i)*uu0 + norm_to_tet_(m,3,1,k,j,i)*uu1);
+    u_tet_[0] = (ntt[0][0]*uu0 + ntt[0][1]*uu1);
+    u_tet_[1] = (ntt[1][0]*uu0 + ntt[1][1]*uu1);
+    u_tet_[2] = (ntt[2][0]*uu0 + ntt[2][1]*uu1);
+    u_tet_[3] = (ntt[3][0]*uu0 + ntt[3][1]*uu1);
 
     // Go through each angle
     for (int n=0; n<nangles_; ++n) {
@@ -159,8 +162,8 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
       }
 
       // Calculate intensity in tetrad frame
-      Real n0 = tet_c_(m,0,0,k,j,i); Real n_0 = 0.0;
-      for (int d=0; d<4; ++d) {  n_0 += tetcov_c_(m,d,0,k,j,i)*nh_c_.d_view(n,d);  }
+      Real n0 = e[0][0]; Real n_0 = 0.0;
+      for (int d=0; d<4; ++d) {  n_0 += ecov[d][0]*nh_c_.d_view(n,d);  }
       i0(m,n,k,j,i) = n0*n_0*ii_f/SQR(SQR(n0_f));
     }
   });
@@ -12,11 +12,14 @@
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
+#include "coordinates/coordinates.hpp"
+#include "coordinates/cell_locations.hpp"
 #include "eos/eos.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "hydro/hydro.hpp"
 #include "driver/driver.hpp"
 #include "radiation/radiation.hpp"
+#include "radiation/radiation_tetrad.hpp"
 
 //----------------------------------------------------------------------------------------
 //! \fn void MeshBlock::UserProblem(ParameterInput *pin)
@@ -63,14 +66,21 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   auto &u0 = pmbp->phydro->u0;
   pmbp->phydro->peos->PrimToCons(w0, u0, 0, (n1-1), 0, (n2-1), 0, (n3-1));
 
-  auto &norm_to_tet_ = pmbp->prad->norm_to_tet;
   auto &nh_c_ = pmbp->prad->nh_c;
-  auto &tet_c_ = pmbp->prad->tet_c;
-  auto &tetcov_c_ = pmbp->prad->tetcov_c;
+  auto &flat = coord.is_minkowski;
+  auto &spin = coord.bh_spin;
 
   auto &i0 = pmbp->prad->i0;
   par_for("rad_relax",DevExeSpace(),0,nmb1,0,(n3-1),0,(n2-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real x1v = CellCenterX(i-is, indcs.nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    Real x2v = CellCenterX(j-js, indcs.nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    Real x3v = CellCenterX(k-ks, indcs.nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+
+    // tetrad (evaluated here since stored tetrads are absent with tetrad_on_the_fly)
+    Real e[4][4], ecov[4][4], ntt[4][4];
+    ComputeCellTetrad(x1v,x2v,x3v,flat,spin,e,ecov,ntt);
+
     // Compute fluid velocity in tetrad frame
     Real uu1 = w0(m,IVX,k,j,i);
     Real uu2 = w0(m,IVY,k,j,i);
@@ -78,14 +88,10 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
     Real uu0 = sqrt(1.0 + SQR(uu1) + SQR(uu2) + SQR(uu3));
 
     Real u_tet_[4];
-    u_tet_[0] = (norm_to_tet_(m,0,0,k,j,i)*uu0 + norm_to_tet_(m,0,1,k,j,i)*uu1 +
-                 norm_to_tet_(m,0,2,k,j,i)*uu2 + norm_to_tet_(m,0,3,k,j,i)*uu3);
-    u_tet_[1] = (norm_to_tet_(m,1,0,k,j,i)*uu0 + norm_to_tet_(m,1,1,k,j,i)*uu1 +
-                 norm_to_tet_(m,1,2,k,j,i)*uu2 + norm_to_tet_(m,1,3,k,j,i)*uu3);
-    u_tet_[2] = (norm_to_tet_(m,2,0,k,j,i)*uu0 + norm_to_tet_(m,2,1,k,j,i)*uu1 +
-                 norm_to_tet_(m,2,2,k,j,i)*uu2 + norm_to_tet_(m,2,3,k,j,i)*uu3);
-    u_tet_[3] = (norm_to_tet_(m,3,0,k,j,i)*uu0 + norm_to_tet_(m,3,1,k,j,i)*uu1 +
-                 norm_to_tet_(m,3,2,k,j,i)*uu2 + norm_to_tet_(m,3,3,k,j,i)*uu3);
+    u_tet_[0] = (ntt[0][0]*uu0 + ntt[0][1]*uu1 + ntt[0][2]*uu2 + ntt[0][3]*uu3);
+    u_tet_[1] = (ntt[1][0]*uu0 + ntt[1][1]*uu1 + ntt[1][2]*uu2 + ntt[1][3]*uu3);
+    u_tet_[2] = (ntt[2][0]*uu0 + ntt[2][1]*uu1 + ntt[2][2]*uu2 + ntt[2][3]*uu3);
+    u_tet_[3] = (ntt[3][0]*uu0 + ntt[3][1]*uu1 + ntt[3][2]*uu2 + ntt[3][3]*uu3);
 
     // Go through each angle
     for (int n=0; n<=nang1; ++n) {
@@ -105,8 +111,8 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
       Real ii_f =  erad/(4.0*M_PI);
 
       // Calculate intensity in tetrad frame
-      Real n0 = tet_c_(m,0,0,k,j,i); Real n_0 = 0.0;
-      for (int d=0; d<4; ++d) {  n_0 += tetcov_c_(m,d,0,k,j,i)*nh_c_.d_view(n,d);  }
+      Real n0 = e[0][0]; Real n_0 = 0.0;
+      for (int d=0; d<4; ++d) {  n_0 += ecov[d][0]*nh_c_.d_view(n,d);  }
       i0(m,n,k,j,i) = n0*n_0*ii_f/SQR(SQR(n0_f));
     }
   });
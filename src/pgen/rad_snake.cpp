@@ -36,6 +36,13 @@ void ComputeSnakeMetricAndTetrad(Real x, Real y, Real z,
 void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
 
+  // snake test overrides stored tetrads, which are not used when computed on the fly
+  if (pmbp->prad->tetrad_on_the_fly) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Snake test requires <radiation>/tetrad_on_the_fly = false" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
   // capture variables for kernel
   auto &indcs = pmy_mesh_->mb_indcs;
   int &ng = indcs.ng;
@@ -10,11 +10,13 @@
 #include <sys/stat.h> // mkdir
 
 #include <algorithm>
+#include <array>
 #include <cstdio>
 #include <iostream>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "athena.hpp"
 #include "coordinates/adm.hpp"
@@ -27,6 +29,7 @@
 #include "mesh/mesh.hpp"
 #include "mhd/mhd.hpp"
 #include "parameter_input.hpp"
+#include "utils/sampled_id.hpp"
 #include "z4c/z4c.hpp"
 #include "z4c/z4c_amr.hpp"
 
@@ -203,6 +206,33 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
   int ncells3 = indcs.nx3 + 2 * (indcs.ng);
   int nmb = pmbp->nmb_thispack;
 
+  // With <problem>/id_sample_npts > 0, SGRID is only called at the sample points
+  // assigned to this rank, which are then interpolated to the mesh on the device.
+  // The finer sample boxes are centered on the two stars.
+  std::vector<std::array<Real, 3>> stars = {{xmax1 * s180, 0.0, 0.0},
+                                            {xmax2 * s180, 0.0, 0.0}};
+  SampledInitialData sid(pin, pmy_mesh_, idvar_NDATAMAX, stars);
+  HostArray5D<Real>::HostMirror host_id_vals;
+  if (sid.enabled) {
+    for (int p = sid.pbeg; p < sid.pend; p++) {
+      Real x, y, z;
+      sid.SampleCoordinates(p, x, y, z);
+      Real xyz[3] = {x * s180 + sgrid_x_CM, y * s180, z};
+      Real IDvars[idvar_NDATAMAX];
+      SGRID_DNSdata_Interpolate_ADMvars_to_xyz(xyz, IDvars, 0);
+      for (int n = 0; n < idvar_NDATAMAX; n++) {
+        sid.values(n, p - sid.pbeg) = IDvars[n];
+      }
+    }
+    for (int n = idvar_q; n <= idvar_VRz; n++) {
+      sid.limit.h_view(n) = 1;
+    }
+    sid.Gather();
+    DvceArray5D<Real> id_vals;
+    sid.InterpolateToMesh(pmbp, id_vals);
+    host_id_vals = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), id_vals);
+  }
+
   // TODO(DR): Use a Kokkos loop to improve performance
   for (int m = 0; m < nmb; m++)
     for (int k = 0; k < ncells3; k++)
@@ -242,7 +272,13 @@ void ProblemGenerator::UserProblem(ParameterInput *pin, const bool restart) {
 
           // Interpolate
           // This call is supposed to be threadsafe, it contains an OMP Critical
-          SGRID_DNSdata_Interpolate_ADMvars_to_xyz(xyz, IDvars, 0);
+          if (sid.enabled) {
+            for (int n = 0; n < idvar_NDATAMAX; n++) {
+              IDvars[n] = host_id_vals(n, m, k, j, i);
+            }
+          } else {
+            SGRID_DNSdata_Interpolate_ADMvars_to_xyz(xyz, IDvars, 0);
+          }
 
           // transform some tensor components, if we have a 180 degree rotation
           IDvars[idvar_Bx] *= s180;
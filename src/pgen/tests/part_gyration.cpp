@@ -0,0 +1,108 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file part_gyration.cpp
+//! \brief Problem generator for gyration of charged particles in a uniform magnetic
+//! field B = b0 in the z-direction, with the fluid at rest (so E = 0).  Particles are
+//! placed at random positions with velocities u = gamma*v of magnitude u_perp
+//! perpendicular to B, so each particle moves on a circle of radius u_perp/(q_over_m*b0)
+//! with period 2*pi*gamma/(q_over_m*b0).  Used to test the Boris pusher.
+
+// C++ headers
+#include <cmath>      // sqrt()
+#include <iostream>   // endl
+
+// Athena++ headers
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "eos/eos.hpp"
+#include "mhd/mhd.hpp"
+#include "particles/particles.hpp"
+#include "pgen/pgen.hpp"
+
+#include <Kokkos_Random.hpp>
+
+//----------------------------------------------------------------------------------------
+//! \fn ProblemGenerator::ParticleGyration()
+//! \brief Sets uniform density, pressure and magnetic field, and random particle
+//! positions and gyration phases.
+
+void ProblemGenerator::ParticleGyration(ParameterInput *pin, const bool restart) {
+  if (restart) return;
+
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  if (pmbp->pmhd == nullptr || pmbp->ppart == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Particle gyration test requires <mhd> and <particles> blocks in "
+              << "input file" << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  Real b0 = pin->GetOrAddReal("problem", "b0", 1.0);
+  Real uperp = pin->GetOrAddReal("problem", "u_perp", 1.0);
+  Real d0 = 1.0;
+  Real p0 = 1.0;
+
+  // capture variables for kernel
+  auto &indcs = pmy_mesh_->mb_indcs;
+  int &is = indcs.is; int &ie = indcs.ie;
+  int &js = indcs.js; int &je = indcs.je;
+  int &ks = indcs.ks; int &ke = indcs.ke;
+
+  EOS_Data &eos = pmbp->pmhd->peos->eos_data;
+  Real gm1 = eos.gamma - 1.0;
+  auto &u0_ = pmbp->pmhd->u0;
+  auto &b0_ = pmbp->pmhd->b0;
+
+  par_for("pgen_gyr1", DevExeSpace(), 0,(pmbp->nmb_thispack-1),ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    u0_(m,IDN,k,j,i) = d0;
+    u0_(m,IM1,k,j,i) = 0.0;
+    u0_(m,IM2,k,j,i) = 0.0;
+    u0_(m,IM3,k,j,i) = 0.0;
+    u0_(m,IEN,k,j,i) = p0/gm1 + 0.5*SQR(b0);
+
+    b0_.x1f(m,k,j,i) = 0.0;
+    b0_.x2f(m,k,j,i) = 0.0;
+    b0_.x3f(m,k,j,i) = b0;
+    if (i==ie) {b0_.x1f(m,k,j,i+1) = 0.0;}
+    if (j==je) {b0_.x2f(m,k,j+1,i) = 0.0;}
+    if (k==ke) {b0_.x3f(m,k+1,j,i) = b0;}
+  });
+
+  // initialize particles at random positions, with random gyration phase
+  auto &pr = pmbp->ppart->prtcl_rdata;
+  auto &pi = pmbp->ppart->prtcl_idata;
+  auto &npart = pmbp->ppart->nprtcl_thispack;
+  auto &mbsize = pmbp->pmb->mb_size;
+  auto gids = pmbp->gids;
+  auto gide = pmbp->gide;
+
+  Kokkos::Random_XorShift64_Pool<> rand_pool64(pmbp->gids);
+  par_for("pgen_gyr2",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    auto rand_gen = rand_pool64.get_state();  // get random number state this thread
+    // choose parent MeshBlock randomly
+    int m = static_cast<int>(rand_gen.frand()*(gide - gids + 1.0));
+    pi(PGID,p) = gids + m;
+
+    Real rand = rand_gen.frand();
+    pr(IPX,p) = (1. - rand)*mbsize.d_view(m).x1min + rand*mbsize.d_view(m).x1max;
+    rand = rand_gen.frand();
+    pr(IPY,p) = (1. - rand)*mbsize.d_view(m).x2min + rand*mbsize.d_view(m).x2max;
+    rand = rand_gen.frand();
+    pr(IPZ,p) = (1. - rand)*mbsize.d_view(m).x3min + rand*mbsize.d_view(m).x3max;
+
+    Real phi = 2.0*M_PI*rand_gen.frand();
+    pr(IPVX,p) = uperp*cos(phi);
+    pr(IPVY,p) = uperp*sin(phi);
+    pr(IPVZ,p) = 0.0;
+
+    rand_pool64.free_state(rand_gen);  // free state for use by other threads
+  });
+
+  return;
+}
@@ -55,6 +55,7 @@ void ProblemGenerator::RadiationBeam(ParameterInput *pin, const bool restart) {
   auto &excision_floor_ = pmbp->pcoord->excision_floor;
 
   auto &tet_c_ = pmbp->prad->tet_c;
+  bool &tet_otf = pmbp->prad->tetrad_on_the_fly;
   par_for("check_tetrad",DevExeSpace(),0,nmb1,0,nang1,0,(n3-1),0,(n2-1),0,(n1-1),
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
     bool excised = false;
@@ -80,6 +81,16 @@ void ProblemGenerator::RadiationBeam(ParameterInput *pin, const bool restart) {
       Real glower[4][4], gupper[4][4];
       ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
 
+      // check the stored tetrad, or the analytic one if tetrads are computed on the fly
+      Real e[4][4];
+      if (tet_otf) {
+        ComputeTetradComponents(x1v,x2v,x3v,flat,spin,e);
+      } else {
+        for (int a=0; a<4; ++a) {
+          for (int b=0; b<4; ++b) { e[a][b] = tet_c_(m,a,b,k,j,i); }
+        }
+      }
+
       // Compute eta_alpha beta = g_mu nu e^mu_alpha e^nu_beta
       Real test_eta[4][4] = {0.0};
       for (int alpha=0; alpha<4; ++alpha) {
@@ -87,8 +98,7 @@ void ProblemGenerator::RadiationBeam(ParameterInput *pin, const bool restart) {
           test_eta[alpha][beta] = 0.0;
           for (int mu=0; mu<4; ++mu) {
             for (int nu=0; nu<4; ++nu) {
-              test_eta[alpha][beta] += (glower[mu][nu]*
-                                        tet_c_(m,alpha,mu,k,j,i)*tet_c_(m,beta,nu,k,j,i));
+              test_eta[alpha][beta] += glower[mu][nu]*e[alpha][mu]*e[beta][nu];
             }
           }
         }
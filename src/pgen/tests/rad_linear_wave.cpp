@@ -21,6 +21,7 @@
 #include "parameter_input.hpp"
 #include "coordinates/cartesian_ks.hpp"
 #include "coordinates/cell_locations.hpp"
+#include "coordinates/coordinates.hpp"
 #include "eos/eos.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "hydro/hydro.hpp"
@@ -250,9 +251,8 @@ void ProblemGenerator::RadiationLinearWave(ParameterInput *pin, const bool resta
   // initialize specific intensity over angles in initial conditions
   if (set_initial_conditions) {
     auto &nh_c_ = pmbp->prad->nh_c;
-    auto &norm_to_tet_ = pmbp->prad->norm_to_tet;
-    auto &tet_c_ = pmbp->prad->tet_c;
-    auto &tetcov_c_ = pmbp->prad->tetcov_c;
+    auto &flat = pmbp->pcoord->coord_data.is_minkowski;
+    auto &spin = pmbp->pcoord->coord_data.bh_spin;
 
     auto &i0 = pmbp->prad->i0;
     par_for("rad_wave2",DevExeSpace(),0,(pmbp->nmb_thispack-1),0,(n3-1),0,(n2-1),0,(n1-1),
@@ -440,15 +440,15 @@ void ProblemGenerator::RadiationLinearWave(ParameterInput *pin, const bool resta
       Real uu3 = u[3];
       Real uu0 = sqrt(1.0 + SQR(uu1) + SQR(uu2) + SQR(uu3));
 
+      // tetrad (evaluated here since stored tetrads are absent with tetrad_on_the_fly)
+      Real e[4][4], ecov[4][4], ntt[4][4];
+      ComputeCellTetrad(x1v,x2v,x3v,flat,spin,e,ecov,ntt);
+
       Real u_tet_[4];
-      u_tet_[0] = (norm_to_tet_(m,0,0,k,j,i)*uu0 + norm_to_tet_(m,0,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,0,2,k,j,i)*uu2 + norm_to_tet_(m,0,3,k,j,i)*uu3);
-      u_tet_[1] = (norm_to_tet_(m,1,0,k,j,i)*uu0 + norm_to_tet_(m,1,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,1,2,k,j,i)*uu2 + norm_to_tet_(m,1,3,k,j,i)*uu3);
-      u_tet_[2] = (norm_to_tet_(m,2,0,k,j,i)*uu0 + norm_to_tet_(m,2,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,2,2,k,j,i)*uu2 + norm_to_tet_(m,2,3,k,j,i)*uu3);
-      u_tet_[3] = (norm_to_tet_(m,3,0,k,j,i)*uu0 + norm_to_tet_(m,3,1,k,j,i)*uu1 +
-                   norm_to_tet_(m,3,2,k,j,i)*uu2 + norm_to_tet_(m,3,3,k,j,i)*uu3);
+      u_tet_[0] = (ntt[0][0]*uu0 + ntt[0][1]*uu1 + ntt[0][2]*uu2 + ntt[0][3]*uu3);
+      u_tet_[1] = (ntt[1][0]*uu0 + ntt[1][1]*uu1 + ntt[1][2]*uu2 + ntt[1][3]*uu3);
+      u_tet_[2] = (ntt[2][0]*uu0 + ntt[2][1]*uu1 + ntt[2][2]*uu2 + ntt[2][3]*uu3);
+      u_tet_[3] = (ntt[3][0]*uu0 + ntt[3][1]*uu1 + ntt[3][2]*uu2 + ntt[3][3]*uu3);
 
       // Go through each angle
       for (int n=0; n<nangles_; ++n) {
@@ -474,8 +474,8 @@ void ProblemGenerator::RadiationLinearWave(ParameterInput *pin, const bool resta
         }
 
         // Calculate intensity in tetrad frame
-        Real n0 = tet_c_(m,0,0,k,j,i); Real n_0 = 0.0;
-        for (int d=0; d<4; ++d) {  n_0 += tetcov_c_(m,d,0,k,j,i)*nh_c_.d_view(n,d);  }
+        Real n0 = e[0][0]; Real n_0 = 0.0;
+        for (int d=0; d<4; ++d) {  n_0 += ecov[d][0]*nh_c_.d_view(n,d);  }
         i0(m,n,k,j,i) = n0*n_0*ii_f/SQR(SQR(n0_f));
       }
     });
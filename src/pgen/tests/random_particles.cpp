@@ -0,0 +1,86 @@
+//========================================================================================
+// AthenaK astrophysical fluid dynamics and numerical relativity code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file random_particles.cpp
+//! \brief Problem generator that initializes random particle positions and velocities.
+//! Particles drift with constant velocity; used to test particle boundaries and restarts.
+
+// C++ headers
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// Athena++ headers
+#include "athena.hpp"
+#include "parameter_input.hpp"
+#include "mesh/mesh.hpp"
+#include "particles/particles.hpp"
+
+#include <Kokkos_Random.hpp>
+
+//----------------------------------------------------------------------------------------
+//! \fn ProblemGenerator::RandomParticles()
+//! \brief Problem Generator for random particle positions/velocities
+
+void ProblemGenerator::RandomParticles(ParameterInput *pin, const bool restart) {
+  MeshBlockPack *pmbp = pmy_mesh_->pmb_pack;
+  if (pmbp->ppart == nullptr) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "Random particles test requires <particles> block in input file"
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  // set timestep (which will remain constant for entire run
+  // Assumes uniform mesh (no SMR or AMR)
+  // Assumes velocities normalized to one, so dt=min(dx)
+  auto &mbsize = pmbp->pmb->mb_size;
+  Real &dtnew_ = pmbp->ppart->dtnew;
+  dtnew_ = std::min(mbsize.h_view(0).dx1, mbsize.h_view(0).dx2);
+  dtnew_ = std::min(dtnew_, mbsize.h_view(0).dx3);
+
+  // particle positions and velocities are read from the restart file
+  if (restart) return;
+
+  // capture variables for the kernel
+  auto &pr = pmbp->ppart->prtcl_rdata;
+  auto &pi = pmbp->ppart->prtcl_idata;
+  auto &npart = pmbp->ppart->nprtcl_thispack;
+  auto gids = pmbp->gids;
+  auto gide = pmbp->gide;
+
+  // initialize particles
+  Kokkos::Random_XorShift64_Pool<> rand_pool64(pmbp->gids);
+  par_for("part_update",DevExeSpace(),0,(npart-1),
+  KOKKOS_LAMBDA(const int p) {
+    auto rand_gen = rand_pool64.get_state();  // get random number state this thread
+    // choose parent MeshBlock randomly
+    int m = static_cast<int>(rand_gen.frand()*(gide - gids + 1.0));
+    pi(PGID,p) = gids + m;
+
+    Real rand = rand_gen.frand();
+    pr(IPX,p) = (1. - rand)*mbsize.d_view(m).x1min + rand*mbsize.d_view(m).x1max;
+    pr(IPX,p) = fmin(pr(IPX,p),mbsize.d_view(m).x1max);
+    pr(IPX,p) = fmax(pr(IPX,p),mbsize.d_view(m).x1min);
+
+    rand = rand_gen.frand();
+    pr(IPY,p) = (1. - rand)*mbsize.d_view(m).x2min + rand*mbsize.d_view(m).x2max;
+    pr(IPY,p) = fmin(pr(IPY,p),mbsize.d_view(m).x2max);
+    pr(IPY,p) = fmax(pr(IPY,p),mbsize.d_view(m).x2min);
+
+    rand = rand_gen.frand();
+    pr(IPZ,p) = (1. - rand)*mbsize.d_view(m).x3min + rand*mbsize.d_view(m).x3max;
+    pr(IPZ,p) = fmin(pr(IPZ,p),mbsize.d_view(m).x3max);
+    pr(IPZ,p) = fmax(pr(IPZ,p),mbsize.d_view(m).x3min);
+
+    pr(IPVX,p) = 2.0*(rand_gen.frand() - 0.5);
+    pr(IPVY,p) = 2.0*(rand_gen.frand() - 0.5);
+    pr(IPVZ,p) = 2.0*(rand_gen.frand() - 0.5);
+
+    rand_pool64.free_state(rand_gen);  // free state for use by other threads
+  });
+
+  return;
+}
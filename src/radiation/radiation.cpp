@@ -13,6 +13,7 @@
 #include <string>
 
 #include "athena.hpp"
+#include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "eos/eos.hpp"
@@ -30,6 +31,7 @@ namespace radiation {
 Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
     pmy_pack(ppack),
     i0("i0",1,1,1,1,1),
+    i0_ang("i0_ang",1,1,1,1,1),
     i1("i1",1,1,1,1,1),
     iflx("iflx",1,1,1,1,1),
     divfa("divfa",1,1,1,1,1),
@@ -92,6 +94,7 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
       arad = pin->GetReal("radiation","arad");
     }
     affect_fluid = pin->GetOrAddBoolean("radiation","affect_fluid",true);
+    team_source = pin->GetOrAddBoolean("radiation","team_source",false);
   }
 
   // Check for fluid evolution
@@ -105,8 +108,18 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   // Setup angular mesh and radiation geometry data
   int nlevel = pin->GetInteger("radiation", "nlevel");
   rotate_geo = pin->GetOrAddBoolean("radiation","rotate_geo",true);
-  angular_fluxes = pin->GetOrAddBoolean("radiation","angular_fluxes",true);
   n_0_floor = pin->GetOrAddReal("radiation","n_0_floor",0.1);
+  // Tetrads can be computed analytically in kernels rather than stored.  In flat
+  // spacetime the angular fluxes vanish identically, so they are off by default.
+  tetrad_on_the_fly = pin->GetOrAddBoolean("radiation","tetrad_on_the_fly",false);
+  bool flat = pmy_pack->pcoord->coord_data.is_minkowski;
+  angular_fluxes = pin->GetOrAddBoolean("radiation","angular_fluxes",
+                                        !(tetrad_on_the_fly && flat));
+  if (tetrad_on_the_fly && flat && angular_fluxes && global_variable::my_rank == 0) {
+    std::cout << "### WARNING in " << __FILE__ << " at line " << __LINE__ << std::endl
+              << "<radiation>/angular_fluxes = true in flat spacetime; angular fluxes "
+              << "vanish identically and only add cost" << std::endl;
+  }
   prgeo = new GeodesicGrid(nlevel, rotate_geo, angular_fluxes);
 
   // Total number of MeshBlocks on this rank to be used in array dimensioning
@@ -118,15 +131,17 @@ Radiation::Radiation(MeshBlockPack *ppack, ParameterInput *pin) :
   int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
   Kokkos::realloc(nh_c,prgeo->nangles,4);
   Kokkos::realloc(nh_f,prgeo->nangles,6,4);
-  Kokkos::realloc(tet_c,nmb,4,4,ncells3,ncells2,ncells1);
-  Kokkos::realloc(tetcov_c,nmb,4,4,ncells3,ncells2,ncells1);
-  Kokkos::realloc(tet_d1_x1f,nmb,4,ncells3,ncells2,ncells1+1);
-  Kokkos::realloc(tet_d2_x2f,nmb,4,ncells3,ncells2+1,ncells1);
-  Kokkos::realloc(tet_d3_x3f,nmb,4,ncells3+1,ncells2,ncells1);
-  if (angular_fluxes) {Kokkos::realloc(na,nmb,prgeo->nangles,ncells3,ncells2,ncells1,6);}
-  if (is_hydro_enabled || is_mhd_enabled) {
-    Kokkos::realloc(norm_to_tet,nmb,4,4,ncells3,ncells2,ncells1);
+  if (!(tetrad_on_the_fly)) {
+    Kokkos::realloc(tet_c,nmb,4,4,ncells3,ncells2,ncells1);
+    Kokkos::realloc(tetcov_c,nmb,4,4,ncells3,ncells2,ncells1);
+    Kokkos::realloc(tet_d1_x1f,nmb,4,ncells3,ncells2,ncells1+1);
+    Kokkos::realloc(tet_d2_x2f,nmb,4,ncells3,ncells2+1,ncells1);
+    Kokkos::realloc(tet_d3_x3f,nmb,4,ncells3+1,ncells2,ncells1);
+    if (is_hydro_enabled || is_mhd_enabled) {
+      Kokkos::realloc(norm_to_tet,nmb,4,4,ncells3,ncells2,ncells1);
+    }
   }
+  if (angular_fluxes) {Kokkos::realloc(na,nmb,prgeo->nangles,ncells3,ncells2,ncells1,6);}
   }
   SetOrthonormalTetrad();
 
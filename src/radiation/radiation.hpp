@@ -104,6 +104,7 @@ class Radiation {
   Real kappa_p;             // Planck - Rosseland mean coefficient
   bool power_opacity;       // flag to enable Kramer's law opacity for kappa_a
   bool is_compton_enabled;  // flag to enable/disable compton
+  bool team_source;         // flag to compute source term angle sums with thread teams
 
   // radiation source term (i.e., beam)
   SourceTerms *psrc = nullptr;
@@ -124,11 +125,13 @@ class Radiation {
   DvceArray5D<Real> tet_d3_x3f;       // tetrad components (subset) at x3f
   DvceArray6D<Real> na;               // n^a
   DvceArray6D<Real> norm_to_tet;      // used in transform b/w normal frame and tet frame
+  bool tetrad_on_the_fly;             // evaluate tetrads analytically in kernels
   void SetOrthonormalTetrad();
 
   // intensity arrays
   DvceArray5D<Real> i0;         // intensities
   DvceArray5D<Real> coarse_i0;  // intensities on 2x coarser grid (for SMR/AMR)
+  DvceArray5D<Real> i0_ang;     // active-zone intensities, angle innermost (team_source)
 
   // Boundary communication buffers and functions for i
   MeshBoundaryValuesCC *pbval_i;
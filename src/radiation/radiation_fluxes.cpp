@@ -11,9 +11,11 @@
 #include "athena.hpp"
 #include "mesh/mesh.hpp"
 #include "coordinates/coordinates.hpp"
+#include "coordinates/cell_locations.hpp"
 #include "eos/eos.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "radiation.hpp"
+#include "radiation_tetrad.hpp"
 #include "reconstruct/dc.hpp"
 #include "reconstruct/plm.hpp"
 #include "reconstruct/ppm.hpp"
@@ -38,6 +40,13 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   auto &nh_c_ = nh_c;
   auto &tet_c_ = tet_c;
 
+  // quantities needed to evaluate face tetrads on the fly
+  bool &tet_otf = tetrad_on_the_fly;
+  auto &size = pmy_pack->pmb->mb_size;
+  auto &coord = pmy_pack->pcoord->coord_data;
+  bool &flat = coord.is_minkowski;
+  Real &spin = coord.bh_spin;
+
   //--------------------------------------------------------------------------------------
   // i-direction
 
@@ -46,20 +55,37 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
   par_for("rflux_x1",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie+1,
   KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
     // calculate n^1 (hence determining upwinding direction)
-    Real n1 = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
-            + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
+    Real n1;
+    if (tet_otf) {
+      Real x1f = LeftEdgeX(i-is, indcs.nx1,
+                           size.d_view(m).x1min, size.d_view(m).x1max);
+      Real x2v = CellCenterX(j-js, indcs.nx2,
+                             size.d_view(m).x2min, size.d_view(m).x2max);
+      Real x3v = CellCenterX(k-ks, indcs.nx3,
+                             size.d_view(m).x3min, size.d_view(m).x3max);
+      Real e[4][4];
+      ComputeTetradComponents(x1f,x2v,x3v,flat,spin,e);
+      n1 = e[0][1]*nh_c_.d_view(n,0) + e[1][1]*nh_c_.d_view(n,1)
+         + e[2][1]*nh_c_.d_view(n,2) + e[3][1]*nh_c_.d_view(n,3);
+    } else {
+      n1 = t1d1(m,0,k,j,i)*nh_c_.d_view(n,0) + t1d1(m,1,k,j,i)*nh_c_.d_view(n,1)
+         + t1d1(m,2,k,j,i)*nh_c_.d_view(n,2) + t1d1(m,3,k,j,i)*nh_c_.d_view(n,3);
+    }
 
-    // convert to primitive n_0 I
+    // coordinate n^0 at cell centers, used to convert to primitive n_0 I
+    auto n0c = [&](const int kk, const int jj, const int ii) {
+      return CellTetradN0(tet_c_,size.d_view(m),indcs,tet_otf,flat,spin,m,kk,jj,ii);
+    };
     Real iim1, iicc, iim2, iip1, iim3, iip2;
-    iim1 = i0_(m,n,k,j,i-1)/tet_c_(m,0,0,k,j,i-1);
-    iicc = i0_(m,n,k,j,i  )/tet_c_(m,0,0,k,j,i  );
+    iim1 = i0_(m,n,k,j,i-1)/n0c(k,j,i-1);
+    iicc = i0_(m,n,k,j,i  )/n0c(k,j,i);
     if (recon_method_ > 0) {
-      iim2 = i0_(m,n,k,j,i-2)/tet_c_(m,0,0,k,j,i-2);
-      iip1 = i0_(m,n,k,j,i+1)/tet_c_(m,0,0,k,j,i+1);
+      iim2 = i0_(m,n,k,j,i-2)/n0c(k,j,i-2);
+      iip1 = i0_(m,n,k,j,i+1)/n0c(k,j,i+1);
     }
     if (recon_method_ > 1) {
-      iim3 = i0_(m,n,k,j,i-3)/tet_c_(m,0,0,k,j,i-3);
-      iip2 = i0_(m,n,k,j,i+2)/tet_c_(m,0,0,k,j,i+2);
+      iim3 = i0_(m,n,k,j,i-3)/n0c(k,j,i-3);
+      iip2 = i0_(m,n,k,j,i+2)/n0c(k,j,i+2);
     }
 
     // reconstruct primitive intensity
@@ -102,20 +128,37 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
     par_for("rflux_x2",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je+1,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
       // calculate n^2 (hence determining upwinding direction)
-      Real n2 = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
+      Real n2;
+      if (tet_otf) {
+        Real x1v = CellCenterX(i-is, indcs.nx1,
+                               size.d_view(m).x1min, size.d_view(m).x1max);
+        Real x2f = LeftEdgeX(j-js, indcs.nx2,
+                             size.d_view(m).x2min, size.d_view(m).x2max);
+        Real x3v = CellCenterX(k-ks, indcs.nx3,
+                               size.d_view(m).x3min, size.d_view(m).x3max);
+        Real e[4][4];
+        ComputeTetradComponents(x1v,x2f,x3v,flat,spin,e);
+        n2 = e[0][2]*nh_c_.d_view(n,0) + e[1][2]*nh_c_.d_view(n,1)
+           + e[2][2]*nh_c_.d_view(n,2) + e[3][2]*nh_c_.d_view(n,3);
+      } else {
+        n2 = t2d2(m,0,k,j,i)*nh_c_.d_view(n,0) + t2d2(m,1,k,j,i)*nh_c_.d_view(n,1)
+           + t2d2(m,2,k,j,i)*nh_c_.d_view(n,2) + t2d2(m,3,k,j,i)*nh_c_.d_view(n,3);
+      }
 
-      // convert to primitive n_0 I
+      // coordinate n^0 at cell centers, used to convert to primitive n_0 I
+      auto n0c = [&](const int kk, const int jj, const int ii) {
+        return CellTetradN0(tet_c_,size.d_view(m),indcs,tet_otf,flat,spin,m,kk,jj,ii);
+      };
       Real iim1, iicc, iim2, iip1, iim3, iip2;
-      iim1 = i0_(m,n,k,j-1,i)/tet_c_(m,0,0,k,j-1,i);
-      iicc = i0_(m,n,k,j  ,i)/tet_c_(m,0,0,k,j  ,i);
+      iim1 = i0_(m,n,k,j-1,i)/n0c(k,j-1,i);
+      iicc = i0_(m,n,k,j  ,i)/n0c(k,j,i);
       if (recon_method_ > 0) {
-        iim2 = i0_(m,n,k,j-2,i)/tet_c_(m,0,0,k,j-2,i);
-        iip1 = i0_(m,n,k,j+1,i)/tet_c_(m,0,0,k,j+1,i);
+        iim2 = i0_(m,n,k,j-2,i)/n0c(k,j-2,i);
+        iip1 = i0_(m,n,k,j+1,i)/n0c(k,j+1,i);
       }
       if (recon_method_ > 1) {
-        iim3 = i0_(m,n,k,j-3,i)/tet_c_(m,0,0,k,j-3,i);
-        iip2 = i0_(m,n,k,j+2,i)/tet_c_(m,0,0,k,j+2,i);
+        iim3 = i0_(m,n,k,j-3,i)/n0c(k,j-3,i);
+        iip2 = i0_(m,n,k,j+2,i)/n0c(k,j+2,i);
       }
 
       // reconstruct primitive intensity
@@ -159,20 +202,37 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
     par_for("rflux_x3",DevExeSpace(),0,nmb1,0,nang1,ks,ke+1,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
       // calculate n^3 (hence determining upwinding direction)
-      Real n3 = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
-              + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
+      Real n3;
+      if (tet_otf) {
+        Real x1v = CellCenterX(i-is, indcs.nx1,
+                               size.d_view(m).x1min, size.d_view(m).x1max);
+        Real x2v = CellCenterX(j-js, indcs.nx2,
+                               size.d_view(m).x2min, size.d_view(m).x2max);
+        Real x3f = LeftEdgeX(k-ks, indcs.nx3,
+                             size.d_view(m).x3min, size.d_view(m).x3max);
+        Real e[4][4];
+        ComputeTetradComponents(x1v,x2v,x3f,flat,spin,e);
+        n3 = e[0][3]*nh_c_.d_view(n,0) + e[1][3]*nh_c_.d_view(n,1)
+           + e[2][3]*nh_c_.d_view(n,2) + e[3][3]*nh_c_.d_view(n,3);
+      } else {
+        n3 = t3d3(m,0,k,j,i)*nh_c_.d_view(n,0) + t3d3(m,1,k,j,i)*nh_c_.d_view(n,1)
+           + t3d3(m,2,k,j,i)*nh_c_.d_view(n,2) + t3d3(m,3,k,j,i)*nh_c_.d_view(n,3);
+      }
 
-      // convert to primitive n_0 I
+      // coordinate n^0 at cell centers, used to convert to primitive n_0 I
+      auto n0c = [&](const int kk, const int jj, const int ii) {
+        return CellTetradN0(tet_c_,size.d_view(m),indcs,tet_otf,flat,spin,m,kk,jj,ii);
+      };
       Real iim1, iicc, iim2, iip1, iim3, iip2;
-      iim1 = i0_(m,n,k-1,j,i)/tet_c_(m,0,0,k-1,j,i);
-      iicc = i0_(m,n,k  ,j,i)/tet_c_(m,0,0,k  ,j,i);
+      iim1 = i0_(m,n,k-1,j,i)/n0c(k-1,j,i);
+      iicc = i0_(m,n,k  ,j,i)/n0c(k,j,i);
       if (recon_method_ > 0) {
-        iim2 = i0_(m,n,k-2,j,i)/tet_c_(m,0,0,k-2,j,i);
-        iip1 = i0_(m,n,k+1,j,i)/tet_c_(m,0,0,k+1,j,i);
+        iim2 = i0_(m,n,k-2,j,i)/n0c(k-2,j,i);
+        iip1 = i0_(m,n,k+1,j,i)/n0c(k+1,j,i);
       }
       if (recon_method_ > 1) {
-        iim3 = i0_(m,n,k-3,j,i)/tet_c_(m,0,0,k-3,j,i);
-        iip2 = i0_(m,n,k+2,j,i)/tet_c_(m,0,0,k+2,j,i);
+        iim3 = i0_(m,n,k-3,j,i)/n0c(k-3,j,i);
+        iip2 = i0_(m,n,k+2,j,i)/n0c(k+2,j,i);
       }
 
       // reconstruct primitive intensity
@@ -221,12 +281,13 @@ TaskStatus Radiation::CalculateFluxes(Driver *pdriver, int stage) {
 
     par_for("rflux_angular",DevExeSpace(),0,nmb1,0,nang1,ks,ke,js,je,is,ie,
     KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
+      Real n0 = CellTetradN0(tet_c_,size.d_view(m),indcs,tet_otf,flat,spin,m,k,j,i);
       divfa_(m,n,k,j,i) = 0.0;
       for (int nb=0; nb<numn.d_view(n); ++nb) {
         Real flx_edge = na_(m,n,k,j,i,nb) *
                         ((na_(m,n,k,j,i,nb) < 0.0) ?
-                         i0_(m,indn.d_view(n,nb),k,j,i)/tet_c_(m,0,0,k,j,i) :
-                         i0_(m,n,k,j,i)/tet_c_(m,0,0,k,j,i));
+                         i0_(m,indn.d_view(n,nb),k,j,i)/n0 :
+                         i0_(m,n,k,j,i)/n0);
         divfa_(m,n,k,j,i) += (arcl.d_view(n,nb)*flx_edge/solid_angles_.d_view(n));
       }
     });
@@ -53,6 +53,9 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
   auto &nh_c_ = nh_c;
   auto &na_ = na;
   auto &tet_c_ = tet_c;
+  bool &tet_otf = tetrad_on_the_fly;
+  auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
+  auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
   auto &excise = pmy_pack->pcoord->coord_data.bh_excise;
   auto &rad_mask_ = pmy_pack->pcoord->excision_floor;
   auto &numn = prgeo->num_neighbors;
@@ -71,6 +74,7 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
 
     Real tmp_min_dta = (FLT_MAX);
     if (angular_fluxes_) {
+      Real n0 = CellTetradN0(tet_c_,size.d_view(m),indcs,tet_otf,flat,spin,m,k,j,i);
       for (int n=0; n<=nang1; ++n) {
         // find position at angle center
         Real x = nh_c_.d_view(n,1);
@@ -82,7 +86,6 @@ TaskStatus Radiation::NewTimeStep(Driver *pdriver, int stage) {
           Real yn = nh_c_.d_view(indn.d_view(n,nb),2);
           Real zn = nh_c_.d_view(indn.d_view(n,nb),3);
           // compute timestep limitation
-          Real n0 = tet_c_(m,0,0,k,j,i);
           Real adt = fmin(tmp_min_dta,(acos(x*xn+y*yn+z*zn)/fabs(na_(m,n,k,j,i,nb)/n0)));
           // set timestep limitation if not excising this cell
           if (excise) {
@@ -21,6 +21,17 @@
 #include "radiation/radiation_tetrad.hpp"
 #include "radiation/radiation_opacities.hpp"
 
+// four simultaneous sums over angles used in team-parallel source term
+using AngleSum4 = array_sum::array_type<Real,4>;
+namespace Kokkos { //reduction identity must be defined in Kokkos namespace
+template<>
+struct reduction_identity< AngleSum4 > {
+  KOKKOS_FORCEINLINE_FUNCTION static AngleSum4 sum() {
+    return AngleSum4();
+  }
+};
+}
+
 namespace radiation {
 
 KOKKOS_INLINE_FUNCTION
@@ -94,6 +105,7 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
   auto &tt = tet_c;
   auto &tc = tetcov_c;
   auto &norm_to_tet_ = norm_to_tet;
+  bool &tetrad_otf = tetrad_on_the_fly;
   auto &solid_angles_ = prgeo->solid_angles;
 
   // Extract hydro/mhd quantities
@@ -120,6 +132,314 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
     }
   }
 
+  // compute implicit source term with one thread team per cell, with the sums over
+  // angles evaluated as vector-lane reductions.  Intended for large angular meshes where
+  // the serial angle loops of the per-cell kernel below limit throughput.  Intensities
+  // are first copied into i0_ang, in which angles are the innermost (contiguous) index,
+  // so that the vector lanes of each team stream through contiguous memory.
+  if (team_source) {
+    const int nmkji = (nmb1 + 1)*(ke - ks + 1)*(je - js + 1)*(ie - is + 1);
+    const int nkji = (ke - ks + 1)*(je - js + 1)*(ie - is + 1);
+    const int nji  = (je - js + 1)*(ie - is + 1);
+    const int ni   = (ie - is + 1);
+    const int nang = nang1 + 1;
+    // (re)allocate angle-innermost storage, number of MBs can change with AMR
+    if (i0_ang.extent_int(0) < (nmb1 + 1) || i0_ang.extent_int(4) != nang ||
+        i0_ang.extent_int(3) != ni) {
+      Kokkos::realloc(i0_ang, nmb1+1, (ke - ks + 1), (je - js + 1), ni, nang);
+    }
+    auto &ia_ = i0_ang;
+    par_for("rad_to_angle_inner",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      for (int n=0; n<nang; ++n) {
+        ia_(m,k-ks,j-js,i-is,n) = i0_(m,n,k,j,i);
+      }
+    });
+
+    Kokkos::TeamPolicy<> policy(DevExeSpace(), nmkji, Kokkos::AUTO);
+    Kokkos::parallel_for("radiation_source_team", policy,
+    KOKKOS_LAMBDA(TeamMember_t tmember) {
+      const int m = (tmember.league_rank())/nkji;
+      const int k = (tmember.league_rank() - m*nkji)/nji + ks;
+      const int j = (tmember.league_rank() - m*nkji - (k-ks)*nji)/ni + js;
+      const int i = (tmember.league_rank() - m*nkji - (k-ks)*nji - (j-js)*ni) + is;
+      const int kk = k - ks, jj = j - js, ii = i - is;  // indices in i0_ang
+
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      // compute metric and inverse
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+      Real alpha = sqrt(-1.0/gupper[0][0]);
+
+      // fluid state
+      Real wdn = w0_(m,IDN,k,j,i);
+      Real wvx = w0_(m,IVX,k,j,i);
+      Real wvy = w0_(m,IVY,k,j,i);
+      Real wvz = w0_(m,IVZ,k,j,i);
+      Real wen = w0_(m,IEN,k,j,i);
+
+      // derived quantities
+      Real pgas = gm1*wen;
+      Real tgas = pgas/wdn;
+      Real q = glower[1][1]*wvx*wvx + 2.0*glower[1][2]*wvx*wvy + 2.0*glower[1][3]*wvx*wvz
+             + glower[2][2]*wvy*wvy + 2.0*glower[2][3]*wvy*wvz
+             + glower[3][3]*wvz*wvz;
+      Real gamma = sqrt(1.0 + q);
+      Real u0 = gamma/alpha;
+
+      // set opacities
+      Real sigma_a, sigma_s, sigma_p;
+      OpacityFunction(wdn, density_scale_,
+                      tgas, temperature_scale_,
+                      length_scale_, gm1, mean_mol_weight_,
+                      power_opacity_, rosseland_coef_, planck_minus_rosseland_coef_,
+                      kappa_a_, kappa_s_, kappa_p_,
+                      sigma_a, sigma_s, sigma_p);
+      Real dtcsiga = dt_*sigma_a;
+      Real dtcsigs = dt_*sigma_s;
+      Real dtcsigp = dt_*sigma_p;
+      Real dtaucsiga = dtcsiga/u0;
+      Real dtaucsigs = dtcsigs/u0;
+      Real dtaucsigp = dtcsigp/u0;
+
+      // covariant tetrad, coordinate n^0, and normal-to-tetrad transformation, either
+      // loaded from stored arrays or evaluated on the fly from the analytic CKS tetrad
+      Real tcov[4][4], ntt[4][4], n0;
+      if (tetrad_otf) {
+        Real e[4][4];
+        ComputeTetradComponents(x1v,x2v,x3v,flat,spin,e);
+        ComputeNormToTetrad(e,glower,gupper,tcov,ntt);
+        n0 = e[0][0];
+      } else {
+        for (int a=0; a<4; ++a) {
+          for (int b=0; b<4; ++b) {
+            tcov[a][b] = tc(m,a,b,k,j,i);
+            ntt[a][b] = norm_to_tet_(m,a,b,k,j,i);
+          }
+        }
+        n0 = tt(m,0,0,k,j,i);
+      }
+
+      // compute fluid velocity in tetrad frame
+      Real u_tet[4];
+      for (int a=0; a<4; ++a) {
+        u_tet[a] = ntt[a][0]*gamma + ntt[a][1]*wvx + ntt[a][2]*wvy + ntt[a][3]*wvz;
+      }
+
+      // Calculate polynomial coefficients
+      AngleSum4 sums;
+      Kokkos::parallel_reduce(Kokkos::TeamVectorRange(tmember, nang),
+      [&](const int n, AngleSum4 &s) {
+        Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1) +
+                   tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
+        Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                      u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+        Real omega_cm = solid_angles_.d_view(n)/SQR(n0_cm);
+        Real intensity_cm = 4.0*M_PI*(ia_(m,kk,jj,ii,n)/(n0*n_0))*SQR(SQR(n0_cm));
+        Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
+        Real vncsigma2 = n0_cm*vncsigma;
+        Real ir_weight = intensity_cm*omega_cm;
+        s.the_array[0] += omega_cm;
+        s.the_array[1] += omega_cm*vncsigma2;
+        s.the_array[2] += ir_weight*n0*vncsigma;
+      }, Kokkos::Sum<AngleSum4>(sums));
+      Real wght_sum = sums.the_array[0];
+      Real suma1 = sums.the_array[1]/wght_sum;
+      Real suma2 = sums.the_array[2]/wght_sum;
+      Real suma3 = suma1*(dtcsigs - dtcsigp);
+      suma1 *= (dtcsiga + dtcsigp);
+
+      // compute coefficients
+      Real coef[2];
+      coef[1] = (dtaucsiga+dtaucsigp-(dtaucsiga+dtaucsigp)*suma1/(1.0-suma3))
+                *arad_*gm1/wdn;
+      coef[0] = -tgas-(dtaucsiga+dtaucsigp)*suma2*gm1/(wdn*(1.0-suma3));
+
+      // Calculate new gas temperature
+      Real tgasnew = tgas;
+      bool badcell = false;
+      if (fabs(coef[1]) > 1.0e-20) {
+        bool flag = FourthPolyRoot(coef[1], coef[0], tgasnew);
+        if (!(flag) || !(isfinite(tgasnew))) {
+          badcell = true;
+          tgasnew = tgas;
+        }
+      } else {
+        tgasnew = -coef[0];
+      }
+
+      // Update the specific intensity, and accumulate change in moments (old - new)
+      if (!(badcell)) {
+        // Calculate emission coefficient and updated jr_cm
+        Real emission = arad_*SQR(SQR(tgasnew));
+        Real jr_cm = (suma1*emission + suma2)/(1.0 - suma3);
+        AngleSum4 dm;
+        Kokkos::parallel_reduce(Kokkos::TeamVectorRange(tmember, nang),
+        [&](const int n, AngleSum4 &s) {
+          // compute coordinate normal components
+          Real nn[4];
+          for (int a=0; a<4; ++a) {
+            nn[a] = tcov[0][a]*nh_c_.d_view(n,0) + tcov[1][a]*nh_c_.d_view(n,1)
+                  + tcov[2][a]*nh_c_.d_view(n,2) + tcov[3][a]*nh_c_.d_view(n,3);
+          }
+          Real iold = ia_(m,kk,jj,ii,n);
+
+          // update intensity
+          Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                        u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+          Real intensity_cm = 4.0*M_PI*(iold/(n0*nn[0]))*SQR(SQR(n0_cm));
+          Real vncsigma = 1.0/(n0 + (dtcsiga + dtcsigs)*n0_cm);
+          Real vncsigma2 = n0_cm*vncsigma;
+          Real di_cm = ( ((dtcsigs-dtcsigp)*jr_cm
+                        + (dtcsiga+dtcsigp)*emission
+                        - (dtcsigs+dtcsiga)*intensity_cm)*vncsigma2 );
+          Real inew = n0*nn[0]*fmax(iold/(n0*nn[0]) +
+                                    di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
+
+          // change in moments due to coupling
+          Real domega = (iold - inew)*solid_angles_.d_view(n);
+          s.the_array[0] += domega;
+          s.the_array[1] += nn[1]*domega/nn[0];
+          s.the_array[2] += nn[2]*domega/nn[0];
+          s.the_array[3] += nn[3]*domega/nn[0];
+
+          // handle excision (see notes in per-cell kernel below)
+          if (excise) {
+            bool apply_excision = (rad_mask_(m,k,j,i) ||
+                                   (!(is_compton_enabled_) && fabs(nn[0]) < n_0_floor_));
+            if (apply_excision) { inew = 0.0; }
+          }
+          ia_(m,kk,jj,ii,n) = inew;
+        }, Kokkos::Sum<AngleSum4>(dm));
+        tmember.team_barrier();
+
+        // update conserved fluid variables
+        if (affect_fluid_) {
+          Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+            u0_(m,IEN,k,j,i) += dm.the_array[0];
+            u0_(m,IM1,k,j,i) += dm.the_array[1];
+            u0_(m,IM2,k,j,i) += dm.the_array[2];
+            u0_(m,IM3,k,j,i) += dm.the_array[3];
+          });
+        }
+      }
+
+      // compton scattering
+      if (is_compton_enabled_) {
+        // use partially updated gas temperature
+        tgas = tgasnew;
+
+        // compute polynomial coefficients using partially updated gas temp and intensity
+        AngleSum4 csums;
+        Kokkos::parallel_reduce(Kokkos::TeamVectorRange(tmember, nang),
+        [&](const int n, AngleSum4 &s) {
+          Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1) +
+                     tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
+          Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                        u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+          Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
+          Real intensity_cm = 4.0*M_PI*(ia_(m,kk,jj,ii,n)/(n0*n_0))*SQR(SQR(n0_cm));
+          s.the_array[0] += intensity_cm*wght_cm;
+          s.the_array[1] += (n0_cm/n0)*4.0*dtcsigs*inv_t_electron_*wght_cm;
+        }, Kokkos::Sum<AngleSum4>(csums));
+        Real jr_cm = csums.the_array[0];
+        suma1 = csums.the_array[1];
+        suma2 = 4.0*dtaucsigs*inv_t_electron_*gm1/wdn;
+
+        // compute partially updated radiation temperature
+        Real trad = sqrt(sqrt(jr_cm/arad_));
+        const bool temp_equil = (fabs(trad - tgas) < 1.0e-12);
+
+        // Calculate new gas temperature due to Compton
+        Real tradnew = trad;
+        badcell = false;
+        if (!(temp_equil)) {
+          coef[1] = (1.0 + suma2*jr_cm)/(suma1*jr_cm)*arad_;
+          coef[0] = -(1.0 + suma2*jr_cm)/suma1 - tgas;
+          bool flag = FourthPolyRoot(coef[1], coef[0], tradnew);
+          if (!(flag) || !(isfinite(tradnew))) {
+            badcell = true;
+          }
+        }
+
+        // Update the specific intensity
+        if (!(badcell) && !(temp_equil)) {
+          // Compute updated gas temperature
+          tgasnew = (arad_*SQR(SQR(tradnew)) - jr_cm)/(suma1*jr_cm) + tradnew;
+          AngleSum4 dm;
+          Kokkos::parallel_reduce(Kokkos::TeamVectorRange(tmember, nang),
+          [&](const int n, AngleSum4 &s) {
+            // compute coordinate normal components
+            Real nn[4];
+            for (int a=0; a<4; ++a) {
+              nn[a] = tcov[0][a]*nh_c_.d_view(n,0) + tcov[1][a]*nh_c_.d_view(n,1)
+                    + tcov[2][a]*nh_c_.d_view(n,2) + tcov[3][a]*nh_c_.d_view(n,3);
+            }
+            Real iold = ia_(m,kk,jj,ii,n);
+
+            // update intensity
+            Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
+                          u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
+            Real di_cm = (n0_cm/n0)*dtcsigs*4.0*jr_cm*inv_t_electron_*(tgasnew - tradnew);
+            Real inew = n0*nn[0]*fmax(iold/(n0*nn[0]) +
+                                      di_cm/(4.0*M_PI*SQR(SQR(n0_cm))), 0.0);
+
+            // change in moments due to coupling
+            Real domega = (iold - inew)*solid_angles_.d_view(n);
+            s.the_array[0] += domega;
+            s.the_array[1] += nn[1]*domega/nn[0];
+            s.the_array[2] += nn[2]*domega/nn[0];
+            s.the_array[3] += nn[3]*domega/nn[0];
+
+            // handle excision
+            if (excise) {
+              if (rad_mask_(m,k,j,i) || fabs(nn[0]) < n_0_floor_) { inew = 0.0; }
+            }
+            ia_(m,kk,jj,ii,n) = inew;
+          }, Kokkos::Sum<AngleSum4>(dm));
+          tmember.team_barrier();
+
+          // feedback on fluid
+          if (affect_fluid_) {
+            Kokkos::single(Kokkos::PerTeam(tmember), [&]() {
+              u0_(m,IEN,k,j,i) += dm.the_array[0];
+              u0_(m,IM1,k,j,i) += dm.the_array[1];
+              u0_(m,IM2,k,j,i) += dm.the_array[2];
+              u0_(m,IM3,k,j,i) += dm.the_array[3];
+            });
+          }
+        } else if (excise) {
+          // apply any excision delayed by Compton (see notes in per-cell kernel below)
+          Kokkos::parallel_for(Kokkos::TeamVectorRange(tmember, nang), [&](const int n) {
+            Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1) +
+                       tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
+            if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { ia_(m,kk,jj,ii,n) = 0.0; }
+          });
+        }
+      }
+    });
+
+    // copy updated intensities back to i0
+    par_for("rad_from_angle_inner",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      for (int n=0; n<nang; ++n) {
+        i0_(m,n,k,j,i) = ia_(m,k-ks,j-js,i-is,n);
+      }
+    });
+    return TaskStatus::complete;
+  }
+
   // compute implicit source term
   par_for("radiation_source",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
@@ -171,27 +491,38 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
     Real dtaucsigs = dtcsigs/u0;
     Real dtaucsigp = dtcsigp/u0;
 
+    // covariant tetrad, coordinate n^0, and normal-to-tetrad transformation, either
+    // loaded from stored arrays or evaluated on the fly from the analytic CKS tetrad
+    Real tcov[4][4], ntt[4][4], n0;
+    if (tetrad_otf) {
+      Real e[4][4];
+      ComputeTetradComponents(x1v,x2v,x3v,flat,spin,e);
+      ComputeNormToTetrad(e,glower,gupper,tcov,ntt);
+      n0 = e[0][0];
+    } else {
+      for (int a=0; a<4; ++a) {
+        for (int b=0; b<4; ++b) {
+          tcov[a][b] = tc(m,a,b,k,j,i);
+          ntt[a][b] = norm_to_tet_(m,a,b,k,j,i);
+        }
+      }
+      n0 = tt(m,0,0,k,j,i);
+    }
+
     // compute fluid velocity in tetrad frame
     Real u_tet[4];
-    u_tet[0] = (norm_to_tet_(m,0,0,k,j,i)*gamma + norm_to_tet_(m,0,1,k,j,i)*wvx +
-                norm_to_tet_(m,0,2,k,j,i)*wvy   + norm_to_tet_(m,0,3,k,j,i)*wvz);
-    u_tet[1] = (norm_to_tet_(m,1,0,k,j,i)*gamma + norm_to_tet_(m,1,1,k,j,i)*wvx +
-                norm_to_tet_(m,1,2,k,j,i)*wvy   + norm_to_tet_(m,1,3,k,j,i)*wvz);
-    u_tet[2] = (norm_to_tet_(m,2,0,k,j,i)*gamma + norm_to_tet_(m,2,1,k,j,i)*wvx +
-                norm_to_tet_(m,2,2,k,j,i)*wvy   + norm_to_tet_(m,2,3,k,j,i)*wvz);
-    u_tet[3] = (norm_to_tet_(m,3,0,k,j,i)*gamma + norm_to_tet_(m,3,1,k,j,i)*wvx +
-                norm_to_tet_(m,3,2,k,j,i)*wvy   + norm_to_tet_(m,3,3,k,j,i)*wvz);
-
-    // coordinate component n^0
-    Real n0 = tt(m,0,0,k,j,i);
+    u_tet[0] = ntt[0][0]*gamma + ntt[0][1]*wvx + ntt[0][2]*wvy + ntt[0][3]*wvz;
+    u_tet[1] = ntt[1][0]*gamma + ntt[1][1]*wvx + ntt[1][2]*wvy + ntt[1][3]*wvz;
+    u_tet[2] = ntt[2][0]*gamma + ntt[2][1]*wvx + ntt[2][2]*wvy + ntt[2][3]*wvz;
+    u_tet[3] = ntt[3][0]*gamma + ntt[3][1]*wvx + ntt[3][2]*wvy + ntt[3][3]*wvz;
 
     // Calculate polynomial coefficients
     Real wght_sum = 0.0;
     Real suma1 = 0.0;
     Real suma2 = 0.0;
     for (int n=0; n<=nang1; ++n) {
-      Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-                 tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+      Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1) +
+                 tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
       Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                     u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
       Real omega_cm = solid_angles_.d_view(n)/SQR(n0_cm);
@@ -234,14 +565,14 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
       Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
       for (int n=0; n<=nang1; ++n) {
         // compute coordinate normal components
-        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-        Real n_1 = tc(m,0,1,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,1,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,1,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,1,k,j,i)*nh_c_.d_view(n,3);
-        Real n_2 = tc(m,0,2,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,2,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,2,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,2,k,j,i)*nh_c_.d_view(n,3);
-        Real n_3 = tc(m,0,3,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,3,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
+        Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1)
+                 + tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
+        Real n_1 = tcov[0][1]*nh_c_.d_view(n,0) + tcov[1][1]*nh_c_.d_view(n,1)
+                 + tcov[2][1]*nh_c_.d_view(n,2) + tcov[3][1]*nh_c_.d_view(n,3);
+        Real n_2 = tcov[0][2]*nh_c_.d_view(n,0) + tcov[1][2]*nh_c_.d_view(n,1)
+                 + tcov[2][2]*nh_c_.d_view(n,2) + tcov[3][2]*nh_c_.d_view(n,3);
+        Real n_3 = tcov[0][3]*nh_c_.d_view(n,0) + tcov[1][3]*nh_c_.d_view(n,1)
+                 + tcov[2][3]*nh_c_.d_view(n,2) + tcov[3][3]*nh_c_.d_view(n,3);
 
         // compute moments before coupling
         m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
@@ -296,8 +627,8 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
       suma1 = 0.0;
       Real jr_cm = 0.0;
       for (int n=0; n<=nang1; ++n) {
-        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-                   tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+        Real n_0 = tcov[0][0]*nh_c_.d_view(n,0) + tcov[1][0]*nh_c_.d_view(n,1) +
+                   tcov[2][0]*nh_c_.d_view(n,2) + tcov[3][0]*nh_c_.d_view(n,3);
         Real n0_cm = (u_tet[0]*nh_c_.d_view(n,0) - u_tet[1]*nh_c_.d_view(n,1) -
                       u_tet[2]*nh_c_.d_view(n,2) - u_tet[3]*nh_c_.d_view(n,3));
         Real wght_cm = solid_angles_.d_view(n)/SQR(n0_cm)/wght_sum;
@@ -331,14 +662,14 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
         Real m_old[4] = {0.0}; Real m_new[4] = {0.0};
         for (int n=0; n<=nang1; ++n) {
           // compute coordinate normal components
-          Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
-                   + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
-          Real n_1 = tc(m,0,1,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,1,k,j,i)*nh_c_.d_view(n,1)
-                   + tc(m,2,1,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,1,k,j,i)*nh_c_.d_view(n,3);
-          Real n_2 = tc(m,0,2,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,2,k,j,i)*nh_c_.d_view(n,1)
-                   + tc(m,2,2,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,2,k,j,i)*nh_c_.d_view(n,3);
-          Real n_3 = tc(m,0,3,k,j,i)*nh_c_.d_view(n,0)+tc(m,1,3,k,j,i)*nh_c_.d_view(n,1)
-                   + tc(m,2,3,k,j,i)*nh_c_.d_view(n,2)+tc(m,3,3,k,j,i)*nh_c_.d_view(n,3);
+          Real n_0 = tcov[0][0]*nh_c_.d_view(n,0)+tcov[1][0]*nh_c_.d_view(n,1)
+                   + tcov[2][0]*nh_c_.d_view(n,2)+tcov[3][0]*nh_c_.d_view(n,3);
+          Real n_1 = tcov[0][1]*nh_c_.d_view(n,0)+tcov[1][1]*nh_c_.d_view(n,1)
+                   + tcov[2][1]*nh_c_.d_view(n,2)+tcov[3][1]*nh_c_.d_view(n,3);
+          Real n_2 = tcov[0][2]*nh_c_.d_view(n,0)+tcov[1][2]*nh_c_.d_view(n,1)
+                   + tcov[2][2]*nh_c_.d_view(n,2)+tcov[3][2]*nh_c_.d_view(n,3);
+          Real n_3 = tcov[0][3]*nh_c_.d_view(n,0)+tcov[1][3]*nh_c_.d_view(n,1)
+                   + tcov[2][3]*nh_c_.d_view(n,2)+tcov[3][3]*nh_c_.d_view(n,3);
 
           // compute moments before coupling
           m_old[0] += (    i0_(m,n,k,j,i)    *solid_angles_.d_view(n));
@@ -378,10 +709,10 @@ TaskStatus Radiation::RadFluidCoupling(Driver *pdriver, int stage) {
         // was encountered.. apply excision
         if (excise) {
           for (int n=0; n<=nang1; ++n) {
-            Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0)+
-                       tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)+
-                       tc(m,2,0,k,j,i)*nh_c_.d_view(n,2)+
-                       tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+            Real n_0 = tcov[0][0]*nh_c_.d_view(n,0)+
+                       tcov[1][0]*nh_c_.d_view(n,1)+
+                       tcov[2][0]*nh_c_.d_view(n,2)+
+                       tcov[3][0]*nh_c_.d_view(n,3);
             if (rad_mask_(m,k,j,i) || fabs(n_0) < n_0_floor_) { i0_(m,n,k,j,i) = 0.0; }
           }
         }
@@ -69,111 +69,114 @@ void Radiation::SetOrthonormalTetrad() {
   nh_f.template modify<HostMemSpace>();
   nh_f.template sync<DevExeSpace>();
 
-  // set tetrad components
-  auto tet_c_ = tet_c;
-  auto tetcov_c_ = tetcov_c;
-  par_for("tet_c/tetcov_c",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
-    Real dgx[4][4], dgy[4][4], dgz[4][4];
-    ComputeMetricDerivatives(x1v,x2v,x3v,flat,spin,dgx,dgy,dgz);
-    Real e[4][4], e_cov[4][4], omega[4][4][4];
-    ComputeTetrad(x1v,x2v,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
-    for (int d1=0; d1<4; ++d1) {
-      for (int d2=0; d2<4; ++d2) {
-        tet_c_   (m,d1,d2,k,j,i) = e[d1][d2];
-        tetcov_c_(m,d1,d2,k,j,i) = e_cov[d1][d2];
+  // set tetrad components at cell centers and (subset) at faces, unless computed on
+  // the fly in kernels
+  if (!(tetrad_on_the_fly)) {
+    auto tet_c_ = tet_c;
+    auto tetcov_c_ = tetcov_c;
+    par_for("tet_c/tetcov_c",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+      Real dgx[4][4], dgy[4][4], dgz[4][4];
+      ComputeMetricDerivatives(x1v,x2v,x3v,flat,spin,dgx,dgy,dgz);
+      Real e[4][4], e_cov[4][4], omega[4][4][4];
+      ComputeTetrad(x1v,x2v,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
+      for (int d1=0; d1<4; ++d1) {
+        for (int d2=0; d2<4; ++d2) {
+          tet_c_   (m,d1,d2,k,j,i) = e[d1][d2];
+          tetcov_c_(m,d1,d2,k,j,i) = e_cov[d1][d2];
+        }
       }
-    }
-  });
-
-  // set tetrad components (subset) at x1f
-  auto tet_d1_x1f_ = tet_d1_x1f;
-  par_for("tet_d1_x1f",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,n1,
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1f = LeftEdgeX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1f,x2v,x3v,flat,spin,glower,gupper);
-    Real dgx[4][4], dgy[4][4], dgz[4][4];
-    ComputeMetricDerivatives(x1f,x2v,x3v,flat,spin,dgx,dgy,dgz);
-    Real e[4][4], e_cov[4][4], omega[4][4][4];
-    ComputeTetrad(x1f,x2v,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
-    for (int d=0; d<4; ++d) { tet_d1_x1f_(m,d,k,j,i) = e[d][1]; }
-  });
-
-  // set tetrad components (subset) at x2f
-  auto tet_d2_x2f_ = tet_d2_x2f;
-  par_for("tet_d2_x2f",DevExeSpace(),0,(nmb-1),0,(n3-1),0,n2,0,(n1-1),
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2f = LeftEdgeX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
-
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v,x2f,x3v,flat,spin,glower,gupper);
-    Real dgx[4][4], dgy[4][4], dgz[4][4];
-    ComputeMetricDerivatives(x1v,x2f,x3v,flat,spin,dgx,dgy,dgz);
-    Real e[4][4], e_cov[4][4], omega[4][4][4];
-    ComputeTetrad(x1v,x2f,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
-    for (int d=0; d<4; ++d) { tet_d2_x2f_(m,d,k,j,i) = e[d][2]; }
-  });
-
-  // set tetrad components (subset) at x3f
-  auto tet_d3_x3f_ = tet_d3_x3f;
-  par_for("tet_d3_x3f",DevExeSpace(),0,(nmb-1),0,n3,0,(n2-1),0,(n1-1),
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    Real &x1min = size.d_view(m).x1min;
-    Real &x1max = size.d_view(m).x1max;
-    Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
-
-    Real &x2min = size.d_view(m).x2min;
-    Real &x2max = size.d_view(m).x2max;
-    Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
-
-    Real &x3min = size.d_view(m).x3min;
-    Real &x3max = size.d_view(m).x3max;
-    Real x3f = LeftEdgeX(k-ks, indcs.nx3, x3min, x3max);
-
-    Real glower[4][4], gupper[4][4];
-    ComputeMetricAndInverse(x1v,x2v,x3f,flat,spin,glower,gupper);
-    Real dgx[4][4], dgy[4][4], dgz[4][4];
-    ComputeMetricDerivatives(x1v,x2v,x3f,flat,spin,dgx,dgy,dgz);
-    Real e[4][4], e_cov[4][4], omega[4][4][4];
-    ComputeTetrad(x1v,x2v,x3f,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
-    for (int d=0; d<4; ++d) { tet_d3_x3f_(m,d,k,j,i) = e[d][3]; }
-  });
+    });
+
+    // set tetrad components (subset) at x1f
+    auto tet_d1_x1f_ = tet_d1_x1f;
+    par_for("tet_d1_x1f",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,n1,
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1f = LeftEdgeX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1f,x2v,x3v,flat,spin,glower,gupper);
+      Real dgx[4][4], dgy[4][4], dgz[4][4];
+      ComputeMetricDerivatives(x1f,x2v,x3v,flat,spin,dgx,dgy,dgz);
+      Real e[4][4], e_cov[4][4], omega[4][4][4];
+      ComputeTetrad(x1f,x2v,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
+      for (int d=0; d<4; ++d) { tet_d1_x1f_(m,d,k,j,i) = e[d][1]; }
+    });
+
+    // set tetrad components (subset) at x2f
+    auto tet_d2_x2f_ = tet_d2_x2f;
+    par_for("tet_d2_x2f",DevExeSpace(),0,(nmb-1),0,(n3-1),0,n2,0,(n1-1),
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2f = LeftEdgeX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3v = CellCenterX(k-ks, indcs.nx3, x3min, x3max);
+
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1v,x2f,x3v,flat,spin,glower,gupper);
+      Real dgx[4][4], dgy[4][4], dgz[4][4];
+      ComputeMetricDerivatives(x1v,x2f,x3v,flat,spin,dgx,dgy,dgz);
+      Real e[4][4], e_cov[4][4], omega[4][4][4];
+      ComputeTetrad(x1v,x2f,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
+      for (int d=0; d<4; ++d) { tet_d2_x2f_(m,d,k,j,i) = e[d][2]; }
+    });
+
+    // set tetrad components (subset) at x3f
+    auto tet_d3_x3f_ = tet_d3_x3f;
+    par_for("tet_d3_x3f",DevExeSpace(),0,(nmb-1),0,n3,0,(n2-1),0,(n1-1),
+    KOKKOS_LAMBDA(int m, int k, int j, int i) {
+      Real &x1min = size.d_view(m).x1min;
+      Real &x1max = size.d_view(m).x1max;
+      Real x1v = CellCenterX(i-is, indcs.nx1, x1min, x1max);
+
+      Real &x2min = size.d_view(m).x2min;
+      Real &x2max = size.d_view(m).x2max;
+      Real x2v = CellCenterX(j-js, indcs.nx2, x2min, x2max);
+
+      Real &x3min = size.d_view(m).x3min;
+      Real &x3max = size.d_view(m).x3max;
+      Real x3f = LeftEdgeX(k-ks, indcs.nx3, x3min, x3max);
+
+      Real glower[4][4], gupper[4][4];
+      ComputeMetricAndInverse(x1v,x2v,x3f,flat,spin,glower,gupper);
+      Real dgx[4][4], dgy[4][4], dgz[4][4];
+      ComputeMetricDerivatives(x1v,x2v,x3f,flat,spin,dgx,dgy,dgz);
+      Real e[4][4], e_cov[4][4], omega[4][4][4];
+      ComputeTetrad(x1v,x2v,x3f,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
+      for (int d=0; d<4; ++d) { tet_d3_x3f_(m,d,k,j,i) = e[d][3]; }
+    });
+  }
 
   // Calculate n^angle
   if (angular_fluxes) {
@@ -220,7 +223,7 @@ void Radiation::SetOrthonormalTetrad() {
   }
 
   // set transformation between normal and tetrad frame
-  if (is_hydro_enabled || is_mhd_enabled) {
+  if ((is_hydro_enabled || is_mhd_enabled) && !(tetrad_on_the_fly)) {
     auto norm_to_tet_ = norm_to_tet;
     par_for("norm_to_tet",DevExeSpace(),0,(nmb-1),0,(n3-1),0,(n2-1),0,(n1-1),
     KOKKOS_LAMBDA(int m, int k, int j, int i) {
@@ -11,6 +11,8 @@
 #include <math.h>
 
 #include "athena.hpp"
+#include "coordinates/cartesian_ks.hpp"
+#include "coordinates/cell_locations.hpp"
 
 // computes covariant and contravariant components of Cartesian tetrad for CKS
 KOKKOS_INLINE_FUNCTION
@@ -180,4 +182,152 @@ void ComputeTetrad(Real x, Real y, Real z, const bool minkowski, const Real a,
   return;
 }
 
+// computes only the contravariant components of Cartesian tetrad for CKS (no derivatives
+// or Ricci rotation coefficients), for use when tetrads are evaluated inside kernels
+KOKKOS_INLINE_FUNCTION
+void ComputeTetradComponents(Real x, Real y, Real z, const bool minkowski, const Real a,
+                             Real e[][4]) {
+  Real rad = sqrt(SQR(x) + SQR(y) + SQR(z));
+  Real r = sqrt((SQR(rad)-SQR(a)+sqrt(SQR(SQR(rad)-SQR(a))+4.0*SQR(a)*SQR(z)))/2.0);
+  r = fmax(r, 1.0);  // floor r_ks to 0.5*(r_inner + r_outer)
+
+  Real ll1 = (r*x + (a)*y)/( SQR(r) + SQR(a) );
+  Real ll2 = (r*y - (a)*x)/( SQR(r) + SQR(a) );
+  Real ll3 = z/r;
+  Real f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
+  if (minkowski) {f=0.0;}
+
+  Real wa = sqrt(1.0+f);
+  Real wb = sqrt(1.0+f*(SQR(ll1)+SQR(ll2)));
+  Real wc = sqrt(1.0+f*SQR(ll2));
+  Real iwa = 1.0/wa;
+  Real iwb = 1.0/wb;
+  Real iwc = 1.0/wc;
+  e[0][0] = wa;
+  e[0][1] = -f*iwa*ll1;
+  e[0][2] = -f*iwa*ll2;
+  e[0][3] = -f*iwa*ll3;
+  e[1][0] = 0.0;
+  e[1][1] = iwb*wc;
+  e[1][2] = -f*iwb*iwc*ll1*ll2;
+  e[1][3] = 0.0;
+  e[2][0] = 0.0;
+  e[2][1] = 0.0;
+  e[2][2] = iwc;
+  e[2][3] = 0.0;
+  e[3][0] = 0.0;
+  e[3][1] = -f*iwa*iwb*ll1*ll3;
+  e[3][2] = -f*iwa*iwb*ll2*ll3;
+  e[3][3] = iwa*wb;
+
+  return;
+}
+
+// computes covariant tetrad components and transformation from normal frame to tetrad
+// frame given contravariant tetrad and metric (same as stored tetcov_c and norm_to_tet)
+KOKKOS_INLINE_FUNCTION
+void ComputeNormToTetrad(const Real e[][4], const Real g[][4], const Real gi[][4],
+                         Real ecov[][4], Real ntt[][4]) {
+  for (int i=0; i<4; ++i) {
+    for (int j=0; j<4; ++j) {
+      ecov[i][j] = 0.0;
+      for (int k=0; k<4; ++k) {
+        ecov[i][j] += g[j][k]*e[i][k];
+      }
+    }
+  }
+
+  // normal-to-coordinate transformation
+  Real norm_to_coord[4][4] = {0.0};
+  Real alpha = 1.0/sqrt(-gi[0][0]);
+  norm_to_coord[0][0] = 1.0/alpha;
+  norm_to_coord[1][0] = -alpha*gi[0][1];
+  norm_to_coord[2][0] = -alpha*gi[0][2];
+  norm_to_coord[3][0] = -alpha*gi[0][3];
+  norm_to_coord[1][1] = 1.0;
+  norm_to_coord[2][2] = 1.0;
+  norm_to_coord[3][3] = 1.0;
+
+  // lowering the tetrad index with the Minkowski metric only flips the sign of row 0
+  for (int d1=0; d1<4; ++d1) {
+    Real sgn = (d1 == 0) ? -1.0 : 1.0;
+    for (int d2=0; d2<4; ++d2) {
+      ntt[d1][d2] = 0.0;
+      for (int q=0; q<4; ++q) {
+        ntt[d1][d2] += sgn*ecov[d1][q]*norm_to_coord[q][d2];
+      }
+    }
+  }
+
+  return;
+}
+
+// computes coordinate n^0 = e_(0)^0 of the CKS tetrad, which is all the flux and update
+// kernels need from the cell-centered tetrad
+KOKKOS_INLINE_FUNCTION
+Real TetradN0(Real x, Real y, Real z, const bool minkowski, const Real a) {
+  if (minkowski) {return 1.0;}
+  Real rad = sqrt(SQR(x) + SQR(y) + SQR(z));
+  Real r = sqrt((SQR(rad)-SQR(a)+sqrt(SQR(SQR(rad)-SQR(a))+4.0*SQR(a)*SQR(z)))/2.0);
+  r = fmax(r, 1.0);  // floor r_ks to 0.5*(r_inner + r_outer)
+  Real f = 2.0 * SQR(r)*r / (SQR(SQR(r)) + SQR(a)*SQR(z));
+  return sqrt(1.0+f);
+}
+
+// computes contravariant and covariant tetrad and normal-to-tetrad transformation at a
+// point (same as stored tet_c, tetcov_c, and norm_to_tet)
+KOKKOS_INLINE_FUNCTION
+void ComputeCellTetrad(Real x, Real y, Real z, const bool minkowski, const Real a,
+                       Real e[][4], Real ecov[][4], Real ntt[][4]) {
+  Real g[4][4], gi[4][4];
+  ComputeMetricAndInverse(x,y,z,minkowski,a,g,gi);
+  ComputeTetradComponents(x,y,z,minkowski,a,e);
+  ComputeNormToTetrad(e,g,gi,ecov,ntt);
+  return;
+}
+
+// returns coordinate n^0 at cell center (k,j,i) of MeshBlock m, either loaded from the
+// stored tetrad or evaluated analytically when tetrads are computed on the fly
+KOKKOS_INLINE_FUNCTION
+Real CellTetradN0(const DvceArray6D<Real> &tet_c, const RegionSize &size,
+                  const RegionIndcs &indcs, const bool otf, const bool minkowski,
+                  const Real a, const int m, const int k, const int j, const int i) {
+  if (!(otf)) {return tet_c(m,0,0,k,j,i);}
+  Real x1v = CellCenterX(i-indcs.is, indcs.nx1, size.x1min, size.x1max);
+  Real x2v = CellCenterX(j-indcs.js, indcs.nx2, size.x2min, size.x2max);
+  Real x3v = CellCenterX(k-indcs.ks, indcs.nx3, size.x3min, size.x3max);
+  return TetradN0(x1v,x2v,x3v,minkowski,a);
+}
+
+// returns contravariant and covariant tetrad at cell center (k,j,i) of MeshBlock m,
+// either loaded from the stored tet_c and tetcov_c (which problem generators may
+// overwrite) or evaluated analytically at (x,y,z) with metric g when tetrads are computed
+// on the fly
+KOKKOS_INLINE_FUNCTION
+void CellTetrad(const DvceArray6D<Real> &tet_c, const DvceArray6D<Real> &tetcov_c,
+                const bool otf, const Real x, const Real y, const Real z,
+                const bool minkowski, const Real a, const Real g[][4],
+                const int m, const int k, const int j, const int i,
+                Real e[][4], Real ecov[][4]) {
+  if (otf) {
+    ComputeTetradComponents(x,y,z,minkowski,a,e);
+    for (int d1=0; d1<4; ++d1) {
+      for (int d2=0; d2<4; ++d2) {
+        ecov[d1][d2] = 0.0;
+        for (int q=0; q<4; ++q) {
+          ecov[d1][d2] += g[d2][q]*e[d1][q];
+        }
+      }
+    }
+  } else {
+    for (int d1=0; d1<4; ++d1) {
+      for (int d2=0; d2<4; ++d2) {
+        e[d1][d2] = tet_c(m,d1,d2,k,j,i);
+        ecov[d1][d2] = tetcov_c(m,d1,d2,k,j,i);
+      }
+    }
+  }
+  return;
+}
+
 #endif // RADIATION_RADIATION_TETRAD_HPP_
@@ -19,6 +19,7 @@
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "srcterms/srcterms.hpp"
 #include "radiation.hpp"
+#include "radiation_tetrad.hpp"
 
 namespace radiation {
 //----------------------------------------------------------------------------------------
@@ -51,6 +52,9 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
   auto &nh_c_ = nh_c;
   auto &tt = tet_c;
   auto &tc = tetcov_c;
+  bool &tet_otf = tetrad_on_the_fly;
+  auto &flat = pmy_pack->pcoord->coord_data.is_minkowski;
+  auto &spin = pmy_pack->pcoord->coord_data.bh_spin;
 
   auto &angular_fluxes_ = angular_fluxes;
   auto &divfa_ = divfa;
@@ -75,9 +79,29 @@ TaskStatus Radiation::RKUpdate(Driver *pdriver, int stage) {
     if (angular_fluxes_) { i0_(m,n,k,j,i) -= beta_dt*divfa_(m,n,k,j,i); }
 
     // zero intensity if negative
-    Real n0  = tt(m,0,0,k,j,i);
-    Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
-               tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+    Real n0, n_0;
+    if (tet_otf) {
+      Real x1v = CellCenterX(i-is, indcs.nx1, mbsize.d_view(m).x1min,
+                             mbsize.d_view(m).x1max);
+      Real x2v = CellCenterX(j-js, indcs.nx2, mbsize.d_view(m).x2min,
+                             mbsize.d_view(m).x2max);
+      Real x3v = CellCenterX(k-ks, indcs.nx3, mbsize.d_view(m).x3min,
+                             mbsize.d_view(m).x3max);
+      Real glower[4][4], gupper[4][4], e[4][4];
+      ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
+      ComputeTetradComponents(x1v,x2v,x3v,flat,spin,e);
+      n0 = e[0][0];
+      n_0 = 0.0;
+      for (int a=0; a<4; ++a) {
+        Real ecov_a0 = 0.0;
+        for (int q=0; q<4; ++q) { ecov_a0 += glower[0][q]*e[a][q]; }
+        n_0 += ecov_a0*nh_c_.d_view(n,a);
+      }
+    } else {
+      n0  = tt(m,0,0,k,j,i);
+      n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1) +
+            tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+    }
     i0_(m,n,k,j,i) = n0*n_0*fmax((i0_(m,n,k,j,i)/(n0*n_0)), 0.0);
 
     // handle excision
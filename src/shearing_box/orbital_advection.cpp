@@ -9,7 +9,9 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include "athena.hpp"
 #include "globals.hpp"
@@ -41,30 +43,122 @@ OrbitalAdvection::OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin) :
   maxjshift = static_cast<int>((ppack->pmesh->cfl_no)*std::max(xmin,xmax)) + 1;
 
 #if MPI_PARALLEL_ENABLED
-  // For orbital advection, communication is only with x2-face neighbors
-  // initialize vectors of MPI request in 2 elements of fixed length arrays
-  for (int n=0; n<2; ++n) {
-    int nmb = std::max((ppack->nmb_thispack), (ppack->pmesh->nmb_maxperrank));
-    sendbuf[n].vars_req = new MPI_Request[nmb];
-    recvbuf[n].vars_req = new MPI_Request[nmb];
-    for (int m=0; m<nmb; ++m) {
-      sendbuf[n].vars_req[m] = MPI_REQUEST_NULL;
-      recvbuf[n].vars_req[m] = MPI_REQUEST_NULL;
-    }
-  }
   // create unique communicators for shearing box
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_orb_advect);
 #endif
 }
 
 //----------------------------------------------------------------------------------------
-// OrbitalAdvection base class destructor
+//! \fn void OrbitalAdvection::SetPieces()
+//! \brief Finds boundary buffers exchanged with x2-neighbors on other ranks.  With MPI,
+//! all buffers exchanged with the same rank are aggregated into one message, and the
+//! persistent requests are rebuilt only when the partner ranks change (i.e. after the
+//! mesh is refined or load balanced).  Each send piece is labelled by the GID of the
+//! receiving MB (key) and the index of the buffer in the receiving MB (l), so that
+//! sending and receiving ranks order pieces within each message in the same way.
+
+void OrbitalAdvection::SetPieces() {
+  int my_rank = global_variable::my_rank;
+  int nmb = pmy_pack->nmb_thispack;
+  auto &nghbr = pmy_pack->pmb->nghbr;
+  send_pieces.clear();
+  recv_pieces.clear();
+  for (int m=0; m<nmb; ++m) {
+    for (int n=0; n<2; ++n) {
+      // indices of x2-face buffers in nghbr view
+      int nnghbr;
+      if (n==0) {nnghbr=8;} else {nnghbr=12;}
+      if (nghbr.h_view(m,nnghbr).gid >= 0 && nghbr.h_view(m,nnghbr).rank != my_rank) {
+        ShearingBoxPiece p;
+        p.n = n; p.m = m;
+        p.gid = nghbr.h_view(m,nnghbr).gid;
+        p.rank = nghbr.h_view(m,nnghbr).rank;
+        p.tm = -1;
+        p.nrow = 1;
+        p.offset = 0;
+        p.key = p.gid;
+        p.l = (n+1) % 2;
+        send_pieces.push_back(p);
+        p.key = m + pmy_pack->gids;
+        p.l = n;
+        recv_pieces.push_back(p);
+      }
+    }
+  }
+  auto order = [](const ShearingBoxPiece &a, const ShearingBoxPiece &b) {
+    return std::tie(a.rank, a.key, a.l) < std::tie(b.rank, b.key, b.l);
+  };
+  std::sort(send_pieces.begin(), send_pieces.end(), order);
+  std::sort(recv_pieces.begin(), recv_pieces.end(), order);
+
+#if MPI_PARALLEL_ENABLED
+  // every buffer has the same size, so assign slots of that size in messages
+  const auto &vars = sendbuf[0].vars;
+  int bufsize = vars.extent_int(1)*vars.extent_int(2)*vars.extent_int(3)*
+                vars.extent_int(4);
+  std::vector<int> srank, scount, rrank, rcount;
+  int ntot = 0;
+  for (auto &p : send_pieces) {
+    if (srank.empty() || srank.back() != p.rank) {
+      srank.push_back(p.rank);
+      scount.push_back(0);
+    }
+    p.offset = ntot;
+    scount.back() += bufsize;
+    ntot += bufsize;
+  }
+  ntot = 0;
+  for (auto &p : recv_pieces) {
+    if (rrank.empty() || rrank.back() != p.rank) {
+      rrank.push_back(p.rank);
+      rcount.push_back(0);
+    }
+    p.offset = ntot;
+    rcount.back() += bufsize;
+    ntot += bufsize;
+  }
+  send_msgs.Init(srank, scount, true, comm_orb_advect);
+  recv_msgs.Init(rrank, rcount, false, comm_orb_advect);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void OrbitalAdvection::SendPieces()
+//! \brief Copies send buffers of MBs with neighbors on other ranks into the aggregated
+//! messages, and starts the persistent sends.  Used for both CC and FC variables.
+
+void OrbitalAdvection::SendPieces() {
+#if MPI_PARALLEL_ENABLED
+  using Kokkos::ALL;
+  for (auto &p : send_pieces) {
+    auto src = Kokkos::subview(sendbuf[p.n].vars, p.m, ALL, ALL, ALL, ALL);
+    DvceArray4D<Real> dst(send_msgs.data.data() + p.offset, src.extent(0),
+                          src.extent(1), src.extent(2), src.extent(3));
+    Kokkos::deep_copy(DevExeSpace(), dst, src);
+  }
+  // all buffers must be packed before messages are sent
+  Kokkos::fence();
+  send_msgs.Start();
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool OrbitalAdvection::RecvPieces()
+//! \brief Returns false if aggregated messages from other ranks have not all arrived.
+//! Otherwise copies each piece into the recv buffer of its MB and returns true.
 
-OrbitalAdvection::~OrbitalAdvection() {
+bool OrbitalAdvection::RecvPieces() {
 #if MPI_PARALLEL_ENABLED
-  for (int n=0; n<2; ++n) {
-    delete [] sendbuf[n].vars_req;
-    delete [] recvbuf[n].vars_req;
+  if (!(recv_msgs.Test())) {return false;}
+  using Kokkos::ALL;
+  for (auto &p : recv_pieces) {
+    auto dst = Kokkos::subview(recvbuf[p.n].vars, p.m, ALL, ALL, ALL, ALL);
+    DvceArray4D<Real> src(recv_msgs.data.data() + p.offset, dst.extent(0),
+                          dst.extent(1), dst.extent(2), dst.extent(3));
+    Kokkos::deep_copy(DevExeSpace(), dst, src);
   }
 #endif
+  return true;
 }
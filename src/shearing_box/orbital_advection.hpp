@@ -9,6 +9,8 @@
 //! \brief definitions for classes that implement orbital advection abstract base and
 //! derived classes (for CC and FC variables).
 
+#include <vector>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "shearing_box/shearing_box.hpp"
@@ -21,7 +23,6 @@
 class OrbitalAdvection {
  public:
   OrbitalAdvection(MeshBlockPack *ppack, ParameterInput *pin);
-  ~OrbitalAdvection();
 
   // data
   int maxjshift;            // maximum integer shift of any cell in orbital advection
@@ -31,15 +32,24 @@ class OrbitalAdvection {
   // data buffers for orbital advection. Only two x2-faces communicate
   ShearingBoxBoundaryBuffer sendbuf[2], recvbuf[2];
 
+  // buffers sent to and received from MBs on other ranks, sorted by (rank, GID of
+  // receiving MB, index of buffer in receiving MB)
+  std::vector<ShearingBoxPiece> send_pieces, recv_pieces;
+
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicator for orbital advection
   MPI_Comm comm_orb_advect;
+  // messages aggregated by partner rank
+  ShearingBoxMessages send_msgs, recv_msgs;
 #endif
 
   // functions
   TaskStatus InitRecv();
   TaskStatus ClearRecv();
   TaskStatus ClearSend();
+  void SetPieces();
+  void SendPieces();
+  bool RecvPieces();
 
  protected:
   // must use pointer to MBPack and not parent physics module since parent can be one of
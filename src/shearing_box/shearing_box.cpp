@@ -7,11 +7,15 @@
 //! \brief constructor for ShearingBox abstract base class, and utility functions
 
 #include <algorithm>
+#include <cstdlib>
 #include <iostream>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "athena.hpp"
+#include "globals.hpp"
 #include "parameter_input.hpp"
 #include "mesh/mesh.hpp"
 #include "hydro/hydro.hpp"
@@ -66,41 +70,12 @@ ShearingBox::ShearingBox(MeshBlockPack *ppack, ParameterInput *pin) :
   x1bndry_mbgid.template modify<HostMemSpace>();
   x1bndry_mbgid.template sync<DevExeSpace>();
 
-
 #if MPI_PARALLEL_ENABLED
-  // initialize vectors of MPI requests for ix1/ox1 boundaries in fixed length arrays
-  // each MB on x1-face can communicate with up to 3 nghbrs
-  for (int n=0; n<2; ++n) {
-    if (nmb_x1bndry(n) > 0) {
-      sendbuf[n].vars_req = new MPI_Request[3*nmb_x1bndry(n)];
-      recvbuf[n].vars_req = new MPI_Request[3*nmb_x1bndry(n)];
-      for (int m=0; m<nmb_x1bndry(n); ++m) {
-        for (int l=0; l<3; ++l) {
-          sendbuf[n].vars_req[3*m + l] = MPI_REQUEST_NULL;
-          recvbuf[n].vars_req[3*m + l] = MPI_REQUEST_NULL;
-        }
-      }
-    }
-  }
   // create unique communicators for shearing box
   MPI_Comm_dup(MPI_COMM_WORLD, &comm_sbox);
 #endif
 }
 
-//----------------------------------------------------------------------------------------
-// ShearingBox base class destructor
-
-ShearingBox::~ShearingBox() {
-#if MPI_PARALLEL_ENABLED
-  for (int n=0; n<2; ++n) {
-    if (nmb_x1bndry(n) > 0) {
-      delete [] sendbuf[n].vars_req;
-      delete [] recvbuf[n].vars_req;
-    }
-  }
-#endif
-}
-
 //----------------------------------------------------------------------------------------
 //! \fn void ShearingBox::FindTargetMB()
 //! \brief  function to find target MB offset by shear.  Returns GID and rank
@@ -120,3 +95,330 @@ void ShearingBox::FindTargetMB(const int igid, const int jshift, int &gid,
   rank = pm->rank_eachmb[gid];
   return;
 }
+
+//----------------------------------------------------------------------------------------
+//! \fn int ShearingBox::IntegerShift()
+//! \brief Returns the number of pieces (2 or 3) into which the send buffer of a MB on
+//! x1-face n is split by an integer shift of joffset cells, and for each piece the offset
+//! (in MBs) of the target MB, the x2-rows in the send and recv buffers, and the size of
+//! the slot reserved for it in aggregated messages.  Algorithm has three cases:
+//!  * Case1 and case3 are when the integer shift (jr<ng), so that the sending MB
+//!    overlaps the ghost cells of the two neighbors, and so requires copy/send
+//!    to three separate target MBs.
+//!  * Case2 is when the sending MB straddles the boundary between MBs, and so requires
+//!    copy/send to only two target MBs.
+//! This assumes every grid has same number of cells in x2-direction, so the receiving MB
+//! gets piece l from the MB offset by -jshift[l] into the same rows jdst[l].
+
+int ShearingBox::IntegerShift(const int n, const int joffset, int *jshift,
+                              std::pair<int,int> *jsrc, std::pair<int,int> *jdst,
+                              int *nrow) {
+  const auto &indcs = pmy_pack->pmesh->mb_indcs;
+  const int &js = indcs.js, &je = indcs.je;
+  const int &ng = indcs.ng;
+  const int &nx2 = indcs.nx2;
+  int ji = joffset/nx2;
+  int jr = joffset - ji*nx2;
+
+  if (jr < ng) {               //--- CASE 1 (in my nomenclature)
+    if (n==0) {
+      jsrc[0] = std::make_pair(js,js+ng-jr);
+      jsrc[1] = std::make_pair(js,je+1);
+      jsrc[2] = std::make_pair(je-(ng-1)-jr,je+1);
+      jdst[0] = std::make_pair(je+1+jr,je+ng+1);
+      jdst[1] = std::make_pair(js+jr,je+jr+1);
+      jdst[2] = std::make_pair(js-ng,js+jr);
+    } else {
+      jsrc[0] = std::make_pair(js,js+ng+jr);
+      jsrc[1] = std::make_pair(js,je+1);
+      jsrc[2] = std::make_pair(je-(ng-1)+jr,je+1);
+      jdst[0] = std::make_pair(je+1-jr,je+ng+1);
+      jdst[1] = std::make_pair(js-jr,je-jr+1);
+      jdst[2] = std::make_pair(js-ng,js-jr);
+    }
+    // ix1 boundary: send to (target-1) through (target+1)
+    // ox1 boundary: send to (target-1) through (target+1)
+    for (int l=0; l<3; ++l) {
+      if (n==0) {jshift[l] = ji+l-1;} else {jshift[l] = l-1-ji;}
+      nrow[l] = (l==1)? nx2 : 2*ng;
+    }
+    return 3;
+  } else if (jr < (nx2-ng)) {  //--- CASE 2
+    if (n==0) {
+      jsrc[0] = std::make_pair(js,je+ng-jr+1);
+      jsrc[1] = std::make_pair(je-(ng-1)-jr,je+1);
+      jdst[0] = std::make_pair(js+jr,je+ng+1);
+      jdst[1] = std::make_pair(js-ng,js+jr);
+    } else {
+      jsrc[0] = std::make_pair(js,js+ng+jr);
+      jsrc[1] = std::make_pair(js-ng+jr,je+1);
+      jdst[0] = std::make_pair(je-jr+1,je+ng+1);
+      jdst[1] = std::make_pair(js-ng,je-jr+1);
+    }
+    // ix1 boundary: send to (target  ) through (target+1)
+    // ox1 boundary: send to (target-1) through (target  )
+    for (int l=0; l<2; ++l) {
+      if (n==0) {jshift[l] = ji+l;} else {jshift[l] = l-1-ji;}
+      nrow[l] = nx2;
+    }
+    return 2;
+  }
+  //--- CASE 3
+  if (n==0) {
+    jsrc[0] = std::make_pair(js,js+ng+(nx2-jr));
+    jsrc[1] = std::make_pair(js,je+1);
+    jsrc[2] = std::make_pair(je-(ng-1)+(nx2-jr),je+1);
+    jdst[0] = std::make_pair(je+1-(nx2-jr),je+ng+1);
+    jdst[1] = std::make_pair(js-(nx2-jr),je-(nx2-jr)+1);
+    jdst[2] = std::make_pair(js-ng,js-(nx2-jr));
+  } else {
+    jsrc[0] = std::make_pair(js,js+ng-(nx2-jr));
+    jsrc[1] = std::make_pair(js,je+1);
+    jsrc[2] = std::make_pair(je-(ng-1)-(nx2-jr),je+1);
+    jdst[0] = std::make_pair(je+1+(nx2-jr),je+ng+1);
+    jdst[1] = std::make_pair(js+(nx2-jr),je+(nx2-jr)+1);
+    jdst[2] = std::make_pair(js-ng,js+(nx2-jr));
+  }
+  // ix1 boundary: send to (target  ) through (target+2)
+  // ox1 boundary: send to (target-2) through (target  )
+  for (int l=0; l<3; ++l) {
+    if (n==0) {jshift[l] = ji+l;} else {jshift[l] = l-2-ji;}
+    nrow[l] = (l==1)? nx2 : 2*ng;
+  }
+  return 3;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBox::SetShiftPieces()
+//! \brief Finds pieces of send buffers copied/sent to target MBs by the integer shift,
+//! and pieces received from other ranks.  With MPI, pieces exchanged with the same rank
+//! are aggregated into one message, in which each piece is given a slot whose size only
+//! depends on which case applies.  Message sizes are therefore constant while the partner
+//! ranks are unchanged, so the persistent requests are only rebuilt when the shear moves
+//! a boundary MB onto a new target MB owned by a different rank.
+
+void ShearingBox::SetShiftPieces() {
+  int my_rank = global_variable::my_rank;
+  send_pieces.clear();
+  recv_pieces.clear();
+  int jshift[3], nrow[3];
+  std::pair<int,int> jsrc[3], jdst[3];
+  for (int n=0; n<2; ++n) {
+    for (int m=0; m<nmb_x1bndry(n); ++m) {
+      int gid = x1bndry_mbgid.h_view(n,m);
+      int mm = gid - pmy_pack->gids;
+      int joffset  = static_cast<int>(yshear/(pmy_pack->pmb->mb_size.h_view(mm).dx2));
+      int npiece = IntegerShift(n, joffset, jshift, jsrc, jdst, nrow);
+      for (int l=0; l<npiece; ++l) {
+        ShearingBoxPiece p;
+        p.n = n; p.m = m; p.l = l;
+        p.jsrc = jsrc[l];
+        p.jdst = jdst[l];
+        p.nrow = nrow[l];
+        p.offset = 0;
+        // piece l is sent to MB offset by jshift, and received from MB offset by -jshift
+        FindTargetMB(gid, jshift[l], p.gid, p.rank);
+        p.key = p.gid;
+        p.tm = (p.rank == my_rank)? TargetIndex(n, p.gid) : -1;
+        send_pieces.push_back(p);
+        FindTargetMB(gid, -jshift[l], p.gid, p.rank);
+        if (p.rank != my_rank) {
+          p.key = gid;
+          p.tm = m;
+          recv_pieces.push_back(p);
+        }
+      }
+    }
+  }
+  // sending and receiving ranks order pieces in the same way
+  auto order = [](const ShearingBoxPiece &a, const ShearingBoxPiece &b) {
+    return std::tie(a.rank, a.n, a.key, a.l) < std::tie(b.rank, b.n, b.key, b.l);
+  };
+  std::sort(send_pieces.begin(), send_pieces.end(), order);
+  std::sort(recv_pieces.begin(), recv_pieces.end(), order);
+
+#if MPI_PARALLEL_ENABLED
+  // assign slots in aggregated messages, and rebuild requests if partners have changed
+  const auto &vars = sendbuf[0].vars;
+  int rowsize = vars.extent_int(2)*vars.extent_int(3)*vars.extent_int(4);
+  std::vector<int> srank, scount, rrank, rcount;
+  int ntot = 0;
+  for (auto &p : send_pieces) {
+    if (p.rank == my_rank) continue;
+    if (srank.empty() || srank.back() != p.rank) {
+      srank.push_back(p.rank);
+      scount.push_back(0);
+    }
+    p.offset = ntot;
+    scount.back() += p.nrow*rowsize;
+    ntot += p.nrow*rowsize;
+  }
+  ntot = 0;
+  for (auto &p : recv_pieces) {
+    if (rrank.empty() || rrank.back() != p.rank) {
+      rrank.push_back(p.rank);
+      rcount.push_back(0);
+    }
+    p.offset = ntot;
+    rcount.back() += p.nrow*rowsize;
+    ntot += p.nrow*rowsize;
+  }
+  send_msgs.Init(srank, scount, true, comm_sbox);
+  recv_msgs.Init(rrank, rcount, false, comm_sbox);
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBox::ShiftAndSend()
+//! \brief Shifts data in send buffers by integer number of cells.  Uses deep copy if
+//! target MB on same rank, otherwise packs piece into its slot in the aggregated message
+//! and starts the persistent sends.  Used for both CC and FC variables.
+
+void ShearingBox::ShiftAndSend() {
+  using Kokkos::ALL;
+  for (auto &p : send_pieces) {
+    auto src = Kokkos::subview(sendbuf[p.n].vars, p.m, p.jsrc, ALL, ALL, ALL);
+    if (p.rank == global_variable::my_rank) {
+      auto dst = Kokkos::subview(recvbuf[p.n].vars, p.tm, p.jdst, ALL, ALL, ALL);
+      Kokkos::deep_copy(DevExeSpace(), dst, src);
+#if MPI_PARALLEL_ENABLED
+    } else {
+      DvceArray4D<Real> dst(send_msgs.data.data() + p.offset, src.extent(0),
+                            src.extent(1), src.extent(2), src.extent(3));
+      Kokkos::deep_copy(DevExeSpace(), dst, src);
+#endif
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  // all pieces must be packed before messages are sent
+  Kokkos::fence();
+  send_msgs.Start();
+#endif
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool ShearingBox::RecvShifted()
+//! \brief Returns false if aggregated messages from other ranks have not all arrived.
+//! Otherwise unpacks each piece into its rows in the recv buffers and returns true.
+
+bool ShearingBox::RecvShifted() {
+#if MPI_PARALLEL_ENABLED
+  if (!(recv_msgs.Test())) {return false;}
+  using Kokkos::ALL;
+  for (auto &p : recv_pieces) {
+    auto dst = Kokkos::subview(recvbuf[p.n].vars, p.tm, p.jdst, ALL, ALL, ALL);
+    DvceArray4D<Real> src(recv_msgs.data.data() + p.offset, dst.extent(0),
+                          dst.extent(1), dst.extent(2), dst.extent(3));
+    Kokkos::deep_copy(DevExeSpace(), dst, src);
+  }
+#endif
+  return true;
+}
+
+#if MPI_PARALLEL_ENABLED
+//----------------------------------------------------------------------------------------
+//! \fn bool ShearingBoxMessages::Init()
+//! \brief Allocates contiguous storage for messages exchanged with ranks r with sizes c,
+//! and creates one persistent send or receive request per rank.  Does nothing (and
+//! returns false) if partners and sizes are the same as in the previous call.
+
+bool ShearingBoxMessages::Init(const std::vector<int> &r, const std::vector<int> &c,
+                               bool is_send, MPI_Comm comm) {
+  if (data.extent(0) > 0 && r == rank && c == count) {return false;}
+  Free();
+  rank = r;
+  count = c;
+  int nmsg = static_cast<int>(rank.size());
+  offset.resize(nmsg);
+  int ntot = 0;
+  for (int i=0; i<nmsg; ++i) {
+    offset[i] = ntot;
+    ntot += count[i];
+  }
+  Kokkos::realloc(data, std::max(ntot,1));
+
+  bool no_errors=true;
+  req.assign(nmsg, MPI_REQUEST_NULL);
+  for (int i=0; i<nmsg; ++i) {
+    int ierr;
+    if (is_send) {
+      ierr = MPI_Send_init(data.data() + offset[i], count[i], MPI_ATHENA_REAL, rank[i],
+                           0, comm, &(req[i]));
+    } else {
+      ierr = MPI_Recv_init(data.data() + offset[i], count[i], MPI_ATHENA_REAL, rank[i],
+                           0, comm, &(req[i]));
+    }
+    if (ierr != MPI_SUCCESS) {no_errors=false;}
+  }
+  // Quit if MPI error detected
+  if (!(no_errors)) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in creating persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxMessages::Free()
+//! \brief Frees persistent requests, which must be inactive
+
+void ShearingBoxMessages::Free() {
+  for (auto &r : req) {
+    if (r != MPI_REQUEST_NULL) {MPI_Request_free(&r);}
+  }
+  req.clear();
+  rank.clear();
+  count.clear();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxMessages::Start()
+//! \brief Starts all persistent requests
+
+void ShearingBoxMessages::Start() {
+  if (req.empty()) {return;}
+  int ierr = MPI_Startall(static_cast<int>(req.size()), req.data());
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in starting persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn bool ShearingBoxMessages::Test()
+//! \brief Returns true if all requests have completed
+
+bool ShearingBoxMessages::Test() {
+  if (req.empty()) {return true;}
+  int test;
+  int ierr = MPI_Testall(static_cast<int>(req.size()), req.data(), &test,
+                         MPI_STATUSES_IGNORE);
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in testing persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return static_cast<bool>(test);
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void ShearingBoxMessages::Wait()
+//! \brief Waits for all requests to complete
+
+void ShearingBoxMessages::Wait() {
+  if (req.empty()) {return;}
+  int ierr = MPI_Waitall(static_cast<int>(req.size()), req.data(), MPI_STATUSES_IGNORE);
+  if (ierr != MPI_SUCCESS) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+       << std::endl << "MPI error in waiting for persistent requests" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  return;
+}
+#endif
@@ -9,6 +9,9 @@
 //! \brief definitions for classes that implement shearing box abstract base and derived
 //! classes (for CC and FC variables).
 
+#include <utility>
+#include <vector>
+
 #include "athena.hpp"
 #include "parameter_input.hpp"
 #include "tasklist/task_list.hpp"
@@ -36,12 +39,47 @@ struct ShearingBoxTaskIDs {
 struct ShearingBoxBoundaryBuffer {
   // Views that store buffer data and fluxes on device
   DvceArray5D<Real> vars, flux;
+};
+
+//----------------------------------------------------------------------------------------
+//! \struct ShearingBoxPiece
+//! \brief piece of the boundary buffer of one MB copied to (or received from) another
+//! MB.  Used by both the orbital advection (whole buffers) and shearing box (ranges of
+//! x2-rows) methods.
+
+struct ShearingBoxPiece {
+  int n, m, l;                    // buffer index [0,1], index of MB in buffer, piece
+  int gid, rank;                  // GID and rank of partner MB
+  int key;                        // GID of *receiving* MB, used to order pieces
+  int tm;                         // index of receiving MB in buffer (same rank only)
+  std::pair<int,int> jsrc, jdst;  // x2-rows in send/recv buffers
+  int nrow;                       // rows reserved for piece in aggregated message
+  int offset;                     // offset of slot in aggregated message
+};
+
 #if MPI_PARALLEL_ENABLED
-  // vectors of length (number of MBs) to hold MPI requests
-  // Using STL vector causes problems with some GPU compilers, so just use plain C array
-  MPI_Request *vars_req, *flux_req;
-#endif
+//----------------------------------------------------------------------------------------
+//! \struct ShearingBoxMessages
+//! \brief container for MPI messages in which all pieces sent to (or received from) the
+//! same rank are aggregated, communicated with persistent requests.  The requests are
+//! only rebuilt when the partner ranks or message sizes change.
+
+struct ShearingBoxMessages {
+  std::vector<int> rank;          // partner ranks
+  std::vector<int> count;         // number of Reals in message with each partner
+  std::vector<int> offset;        // offset of each message in data
+  DvceArray1D<Real> data;         // all messages stored contiguously on device
+  std::vector<MPI_Request> req;   // one persistent request per partner
+
+  ~ShearingBoxMessages() {Free();}
+  bool Init(const std::vector<int> &r, const std::vector<int> &c, bool is_send,
+            MPI_Comm comm);
+  void Free();
+  void Start();
+  bool Test();
+  void Wait();
 };
+#endif
 
 //----------------------------------------------------------------------------------------
 //! \class ShearingBox
@@ -50,7 +88,6 @@ struct ShearingBoxBoundaryBuffer {
 class ShearingBox {
  public:
   ShearingBox(MeshBlockPack *ppack, ParameterInput *pin);
-  ~ShearingBox();
 
   // data
   HostArray1D<int> nmb_x1bndry;    // number of MBs that touch x1 boundaries
@@ -64,15 +101,27 @@ class ShearingBox {
   // Use seperate variables for ix1/ox1 since number of MBs on each face can be different
   ShearingBoxBoundaryBuffer sendbuf[2], recvbuf[2];
 
+  // pieces of send buffers copied/sent to target MBs, and received from other ranks.
+  // Both lists are sorted by (rank, n, GID of receiving MB, l)
+  std::vector<ShearingBoxPiece> send_pieces, recv_pieces;
+
 #if MPI_PARALLEL_ENABLED
   // unique MPI communicator for shearing box
   MPI_Comm comm_sbox;
+  // messages aggregated by partner rank
+  ShearingBoxMessages send_msgs, recv_msgs;
 #endif
 
   // functions
   TaskStatus InitRecv(Real time);
   TaskStatus ClearRecv();
   TaskStatus ClearSend();
+  // functions to shift send buffers by integer number of cells, shared by CC/FC vars
+  int IntegerShift(const int n, const int joffset, int *jshift,
+                   std::pair<int,int> *jsrc, std::pair<int,int> *jdst, int *nrow);
+  void SetShiftPieces();
+  void ShiftAndSend();
+  bool RecvShifted();
   // function to find target MB offset by shear.  Returns GID and rank
   void FindTargetMB(const int igid, const int jshift, int &gid, int &rank);
   // function to find index in x1bndry array of MB with input GID
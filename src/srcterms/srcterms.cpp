@@ -241,9 +241,10 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
   Real &width_ = width;
   Real &spread_ = spread;
 
-  auto &tc = pmy_pack->prad->tetcov_c;
   auto &nh_c_ = pmy_pack->prad->nh_c;
   auto &tet_c_ = pmy_pack->prad->tet_c;
+  auto &tetcov_c_ = pmy_pack->prad->tetcov_c;
+  bool &tet_otf = pmy_pack->prad->tetrad_on_the_fly;
   par_for("rad_beam",DevExeSpace(),0,nmb1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
     Real &x1min = size.d_view(m).x1min;
@@ -260,10 +261,9 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
 
     Real glower[4][4], gupper[4][4];
     ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
-    Real dgx[4][4], dgy[4][4], dgz[4][4];
-    ComputeMetricDerivatives(x1v,x2v,x3v,flat,spin,dgx,dgy,dgz);
-    Real e[4][4], e_cov[4][4], omega[4][4][4];
-    ComputeTetrad(x1v,x2v,x3v,flat,spin,glower,gupper,dgx,dgy,dgz,e,e_cov,omega);
+    // stored tetrad, or evaluated analytically with tetrad_on_the_fly
+    Real e[4][4], e_cov[4][4];
+    CellTetrad(tet_c_,tetcov_c_,tet_otf,x1v,x2v,x3v,flat,spin,glower,m,k,j,i,e,e_cov);
 
     // Calculate proper distance to beam origin and minimum angle between directions
     Real dx1 = x1v - p1;
@@ -289,14 +289,10 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
     Real dc3 = glower[0][3]*d0 + glower[1][3]*d1 + glower[2][3]*d2 + glower[3][3]*d3;
 
     // Calculate covariant direction in tetrad frame
-    Real dtc0 = (tet_c_(m,0,0,k,j,i)*dc0 + tet_c_(m,0,1,k,j,i)*dc1 +
-                 tet_c_(m,0,2,k,j,i)*dc2 + tet_c_(m,0,3,k,j,i)*dc3);
-    Real dtc1 = (tet_c_(m,1,0,k,j,i)*dc0 + tet_c_(m,1,1,k,j,i)*dc1 +
-                 tet_c_(m,1,2,k,j,i)*dc2 + tet_c_(m,1,3,k,j,i)*dc3)/(-dtc0);
-    Real dtc2 = (tet_c_(m,2,0,k,j,i)*dc0 + tet_c_(m,2,1,k,j,i)*dc1 +
-                 tet_c_(m,2,2,k,j,i)*dc2 + tet_c_(m,2,3,k,j,i)*dc3)/(-dtc0);
-    Real dtc3 = (tet_c_(m,3,0,k,j,i)*dc0 + tet_c_(m,3,1,k,j,i)*dc1 +
-                 tet_c_(m,3,2,k,j,i)*dc2 + tet_c_(m,3,3,k,j,i)*dc3)/(-dtc0);
+    Real dtc0 = (e[0][0]*dc0 + e[0][1]*dc1 + e[0][2]*dc2 + e[0][3]*dc3);
+    Real dtc1 = (e[1][0]*dc0 + e[1][1]*dc1 + e[1][2]*dc2 + e[1][3]*dc3)/(-dtc0);
+    Real dtc2 = (e[2][0]*dc0 + e[2][1]*dc1 + e[2][2]*dc2 + e[2][3]*dc3)/(-dtc0);
+    Real dtc3 = (e[3][0]*dc0 + e[3][1]*dc1 + e[3][2]*dc2 + e[3][3]*dc3)/(-dtc0);
 
     // Go through angles
     for (int n=0; n<=nang1; ++n) {
@@ -304,9 +300,9 @@ void SourceTerms::BeamSource(DvceArray5D<Real> &i0, const Real bdt) {
                + nh_c_.d_view(n,2) * dtc2
                + nh_c_.d_view(n,3) * dtc3);
       if ((dx_sq < SQR(width_/2.0)) && (mu > mu_min)) {
-        Real n0 = tet_c_(m,0,0,k,j,i);
-        Real n_0 = tc(m,0,0,k,j,i)*nh_c_.d_view(n,0) + tc(m,1,0,k,j,i)*nh_c_.d_view(n,1)
-                 + tc(m,2,0,k,j,i)*nh_c_.d_view(n,2) + tc(m,3,0,k,j,i)*nh_c_.d_view(n,3);
+        Real n0 = e[0][0];
+        Real n_0 = e_cov[0][0]*nh_c_.d_view(n,0) + e_cov[1][0]*nh_c_.d_view(n,1)
+                 + e_cov[2][0]*nh_c_.d_view(n,2) + e_cov[3][0]*nh_c_.d_view(n,3);
         i0(m,n,k,j,i) += n0*n_0*dii_dt_*bdt;
       }
     }
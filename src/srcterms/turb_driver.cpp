@@ -32,15 +32,11 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
   pmy_pack(pp),
   force("force",1,1,1,1,1),
   force_tmp("force_tmp",1,1,1,1,1),
-  xccc("xccc",1),xccs("xccs",1),xcsc("xcsc",1),xcss("xcss",1),
-  xscc("xscc",1),xscs("xscs",1),xssc("xssc",1),xsss("xsss",1),
-  yccc("yccc",1),yccs("yccs",1),ycsc("ycsc",1),ycss("ycss",1),
-  yscc("yscc",1),yscs("yscs",1),yssc("yssc",1),ysss("ysss",1),
-  zccc("zccc",1),zccs("zccs",1),zcsc("zcsc",1),zcss("zcss",1),
-  zscc("zscc",1),zscs("zscs",1),zssc("zssc",1),zsss("zsss",1),
+  amp("amp",1,1),
   kx_mode("kx_mode",1),ky_mode("ky_mode",1),kz_mode("kz_mode",1),
   xcos("xcos",1,1,1),xsin("xsin",1,1,1),ycos("ycos",1,1,1),
-  ysin("ysin",1,1,1),zcos("zcos",1,1,1),zsin("zsin",1,1,1) {
+  ysin("ysin",1,1,1),zcos("zcos",1,1,1),zsin("zsin",1,1,1),
+  rng("rng",1) {
   // allocate memory for force registers
   int nmb = pmy_pack->nmb_thispack;
   auto &indcs = pmy_pack->pmesh->mb_indcs;
@@ -64,6 +60,8 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
   dedt = pin->GetOrAddReal("turb_driving", "dedt", 0.0);
   // correlation time
   tcorr = pin->GetOrAddReal("turb_driving", "tcorr", 0.0);
+  // draw random amplitudes on device (avoids host-device copies every forcing step)
+  rng_on_device = pin->GetOrAddBoolean("turb_driving", "rng_on_device", false);
 
   Real nlow_sqr = nlow*nlow;
   Real nhigh_sqr = nhigh*nhigh;
@@ -96,32 +94,7 @@ TurbulenceDriver::TurbulenceDriver(MeshBlockPack *pp, ParameterInput *pin) :
     }
   }
 
-  Kokkos::realloc(xccc, mode_count);
-  Kokkos::realloc(xccs, mode_count);
-  Kokkos::realloc(xcsc, mode_count);
-  Kokkos::realloc(xcss, mode_count);
-  Kokkos::realloc(xscc, mode_count);
-  Kokkos::realloc(xscs, mode_count);
-  Kokkos::realloc(xssc, mode_count);
-  Kokkos::realloc(xsss, mode_count);
-
-  Kokkos::realloc(yccc, mode_count);
-  Kokkos::realloc(yccs, mode_count);
-  Kokkos::realloc(ycsc, mode_count);
-  Kokkos::realloc(ycss, mode_count);
-  Kokkos::realloc(yscc, mode_count);
-  Kokkos::realloc(yscs, mode_count);
-  Kokkos::realloc(yssc, mode_count);
-  Kokkos::realloc(ysss, mode_count);
-
-  Kokkos::realloc(zccc, mode_count);
-  Kokkos::realloc(zccs, mode_count);
-  Kokkos::realloc(zcsc, mode_count);
-  Kokkos::realloc(zcss, mode_count);
-  Kokkos::realloc(zscc, mode_count);
-  Kokkos::realloc(zscs, mode_count);
-  Kokkos::realloc(zssc, mode_count);
-  Kokkos::realloc(zsss, mode_count);
+  Kokkos::realloc(amp, mode_count, NAMP);
 
   Kokkos::realloc(kx_mode, mode_count);
   Kokkos::realloc(ky_mode, mode_count);
@@ -274,6 +247,19 @@ void TurbulenceDriver::Initialize() {
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn  void SyncRNGStateToHost
+//  \brief Copies the state of the random stream back to rstate when it is evolved on the
+//  device, so that it can be written to restart files.
+
+void TurbulenceDriver::SyncRNGStateToHost() {
+  if (rng_on_device && rng_dvce_current) {
+    rng.template sync<HostMemSpace>();
+    rstate = rng.h_view(0);
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn  void IncludeModeEvolutionTasks
 //  \brief Includes task in the operator split task list that constructs new modes with
@@ -282,8 +268,10 @@ void TurbulenceDriver::Initialize() {
 
 void TurbulenceDriver::IncludeInitializeModesTask(std::shared_ptr<TaskList> tl,
                                                   TaskID start) {
-  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start);
-  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init);
+  auto id_init = tl->AddTask(&TurbulenceDriver::InitializeModes, this, start,
+                             "TurbulenceDriver::InitializeModes");
+  auto id_add = tl->AddTask(&TurbulenceDriver::AddForcing, this, id_init,
+                            "TurbulenceDriver::AddForcing");
   return;
 }
 
@@ -312,6 +300,148 @@ void TurbulenceDriver::IncludeAddForcingTask(std::shared_ptr<TaskList> tl, TaskI
   return;
 }
 
+//----------------------------------------------------------------------------------------
+//! \fn void TurbulenceDriver::GenerateAmplitudes()
+//  \brief Draws new random amplitudes of all driven modes from the Gaussian stream in
+//  *prs and stores them (normalized by the driving spectrum) in amp(mode,NAMP).  Modes
+//  are visited in the same order in which they are counted in the constructor.  Inline
+//  so the same code runs on the host, or in a single device thread with rng_on_device.
+
+template <typename ViewType>
+KOKKOS_INLINE_FUNCTION
+void TurbulenceDriver::GenerateAmplitudes(const ViewType &amp, RNG_State *prs,
+                                          const int nlow, const int nhigh,
+                                          const int driving_type,
+                                          const Real dkx, const Real dky, const Real dkz,
+                                          const Real ex, const Real ex_prp,
+                                          const Real ex_prl) {
+  int nlow_sqr = SQR(nlow);
+  int nhigh_sqr = SQR(nhigh);
+  int nmode = 0;
+  for (int nkx = 0; nkx <= nhigh; nkx++) {
+    for (int nky = 0; nky <= nhigh; nky++) {
+      for (int nkz = 0; nkz <= nhigh; nkz++) {
+        if (nkx == 0 && nky == 0 && nkz == 0) continue;
+        int nsqr = 0;
+        bool flag_prl = true;
+        if (driving_type == 0) {
+          nsqr = SQR(nkx) + SQR(nky) + SQR(nkz);
+        } else if (driving_type == 1) {
+          nsqr = SQR(nkx) + SQR(nky);
+          int nprlsqr = SQR(nkz);
+          flag_prl = (nprlsqr >= nlow_sqr && nprlsqr <= nhigh_sqr);
+        }
+        if (nsqr < nlow_sqr || nsqr > nhigh_sqr || !flag_prl) continue;
+
+        Real kx = dkx*nkx;
+        Real ky = dky*nky;
+        Real kz = dkz*nkz;
+        Real norm = 0.0;
+        const int n = nmode;
+        for (int a=0; a<NAMP; ++a) {
+          amp(n,a) = 0.0;
+        }
+
+        // Generate Fourier amplitudes; those not set below remain zero.  The order in
+        // which random numbers are drawn is that of the original per-array version.
+        if (driving_type == 0) {
+          Real kiso = sqrt(SQR(kx) + SQR(ky) + SQR(kz));
+          if (kiso > 1e-16) {
+            norm = 1.0/pow(kiso,(ex+2.0)/2.0);
+          }
+          if (nkz != 0) {
+            Real ikz = 1.0/(dkz*(static_cast<Real>(nkz)));
+            for (int c=0; c<2; ++c) {  // x- and then y-components
+              int o = (c == 0)? XCCC : YCCC;
+              amp(n,o+XCCC) = RanGaussianSt(prs);
+              amp(n,o+XCCS) = RanGaussianSt(prs);
+              if (nky != 0) {
+                amp(n,o+XCSC) = RanGaussianSt(prs);
+                amp(n,o+XCSS) = RanGaussianSt(prs);
+              }
+              if (nkx != 0) {
+                amp(n,o+XSCC) = RanGaussianSt(prs);
+                amp(n,o+XSCS) = RanGaussianSt(prs);
+              }
+              if (nkx != 0 && nky != 0) {
+                amp(n,o+XSSC) = RanGaussianSt(prs);
+                amp(n,o+XSSS) = RanGaussianSt(prs);
+              }
+            }
+            // incompressibility
+            amp(n,ZCCC) =  ikz*( kx*amp(n,XSCS) + ky*amp(n,YCSS));
+            amp(n,ZCCS) = -ikz*( kx*amp(n,XSCC) + ky*amp(n,YCSC));
+            amp(n,ZCSC) =  ikz*( kx*amp(n,XSSS) - ky*amp(n,YCCS));
+            amp(n,ZCSS) =  ikz*(-kx*amp(n,XSSC) + ky*amp(n,YCCC));
+            amp(n,ZSCC) =  ikz*(-kx*amp(n,XCCS) + ky*amp(n,YSSS));
+            amp(n,ZSCS) =  ikz*( kx*amp(n,XCCC) - ky*amp(n,YSSC));
+            amp(n,ZSSC) = -ikz*( kx*amp(n,XCSS) + ky*amp(n,YSCS));
+            amp(n,ZSSS) =  ikz*( kx*amp(n,XCSC) + ky*amp(n,YSCC));
+          } else if (nky != 0) {  // kz == 0
+            Real iky = 1.0/(dky*(static_cast<Real>(nky)));
+            for (int c=0; c<2; ++c) {  // x- and then z-components
+              int o = (c == 0)? XCCC : ZCCC;
+              amp(n,o+XCCC) = RanGaussianSt(prs);
+              amp(n,o+XCSC) = RanGaussianSt(prs);
+              if (nkx != 0) {
+                amp(n,o+XSCC) = RanGaussianSt(prs);
+                amp(n,o+XSSC) = RanGaussianSt(prs);
+              }
+            }
+            // incompressibility
+            amp(n,YCCC) =  iky*kx*amp(n,XSSC);
+            amp(n,YCSC) = -iky*kx*amp(n,XSCC);
+            amp(n,YSCC) = -iky*kx*amp(n,XCSC);
+            amp(n,YSSC) =  iky*kx*amp(n,XCCC);
+          } else {  // kz == ky == 0, kx != 0 by initial if statement
+            amp(n,ZCCC) = RanGaussianSt(prs);
+            amp(n,ZSCC) = RanGaussianSt(prs);
+            amp(n,YCCC) = RanGaussianSt(prs);
+            amp(n,YSCC) = RanGaussianSt(prs);
+          }
+        } else if (driving_type == 1) {
+          Real kprl = sqrt(SQR(kx));
+          Real kprp = sqrt(SQR(ky) + SQR(kz));
+          if (kprl > 1e-16 && kprp > 1e-16) {
+            norm = 1.0/pow(kprp,(ex_prp+1.0)/2.0)/pow(kprl,ex_prl/2.0);
+          }
+          if (nky != 0) {
+            Real iky = 1.0/(dky*(static_cast<Real>(nky)));
+            amp(n,XCCC) = RanGaussianSt(prs);
+            amp(n,XCCS) = RanGaussianSt(prs);
+            amp(n,XCSC) = RanGaussianSt(prs);
+            amp(n,XCSS) = RanGaussianSt(prs);
+            if (nkx != 0) {
+              amp(n,XSCC) = RanGaussianSt(prs);
+              amp(n,XSCS) = RanGaussianSt(prs);
+              amp(n,XSSC) = RanGaussianSt(prs);
+              amp(n,XSSS) = RanGaussianSt(prs);
+            }
+            // incompressibility
+            amp(n,YCCC) =  iky*(kx*amp(n,XSSC));
+            amp(n,YCCS) =  iky*(kx*amp(n,XSSS));
+            amp(n,YCSC) = -iky*(kx*amp(n,XSCC));
+            amp(n,YCSS) = -iky*(kx*amp(n,XSCS));
+            amp(n,YSCC) = -iky*(kx*amp(n,XCSC));
+            amp(n,YSCS) = -iky*(kx*amp(n,XCSS));
+            amp(n,YSSC) =  iky*(kx*amp(n,XCCC));
+            amp(n,YSSS) =  iky*(kx*amp(n,XCCS));
+          } else {  // ky == 0
+            amp(n,YCCC) = RanGaussianSt(prs);
+            amp(n,YSCC) = RanGaussianSt(prs);
+          }
+        }
+        // normalization
+        for (int a=0; a<NAMP; ++a) {
+          amp(n,a) *= norm;
+        }
+        nmode++;
+      }
+    }
+  }
+  return;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn InitializeModes()
 // \brief Initializes driving, and so is only executed once at start of calc.
@@ -333,371 +463,81 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
 
   // Now compute new force using new random amplitudes and phases
 
-  // Zero out new force array
   auto force_tmp_ = force_tmp;
   int &nmb = pmy_pack->nmb_thispack;
-  par_for("force_init", DevExeSpace(),0,nmb-1,0,2,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(int m, int n, int k, int j, int i) {
-    force_tmp_(m,n,k,j,i) = 0.0;
-  });
-
-  int nlow_sqr = SQR(nlow);
-  int nhigh_sqr = SQR(nhigh);
   auto mode_count_ = mode_count;
 
-  auto xccc_ = xccc;
-  auto xccs_ = xccs;
-  auto xcsc_ = xcsc;
-  auto xcss_ = xcss;
-  auto xscc_ = xscc;
-  auto xscs_ = xscs;
-  auto xssc_ = xssc;
-  auto xsss_ = xsss;
-
-  auto yccc_ = yccc;
-  auto yccs_ = yccs;
-  auto ycsc_ = ycsc;
-  auto ycss_ = ycss;
-  auto yscc_ = yscc;
-  auto yscs_ = yscs;
-  auto yssc_ = yssc;
-  auto ysss_ = ysss;
-
-  auto zccc_ = zccc;
-  auto zccs_ = zccs;
-  auto zcsc_ = zcsc;
-  auto zcss_ = zcss;
-  auto zscc_ = zscc;
-  auto zscs_ = zscs;
-  auto zssc_ = zssc;
-  auto zsss_ = zsss;
-
-  Real dkx, dky, dkz, kx, ky, kz;
-  Real iky, ikz;
   Real lx = pm->mesh_size.x1max - pm->mesh_size.x1min;
   Real ly = pm->mesh_size.x2max - pm->mesh_size.x2min;
   Real lz = pm->mesh_size.x3max - pm->mesh_size.x3min;
-  dkx = 2.0*M_PI/lx;
-  dky = 2.0*M_PI/ly;
-  dkz = 2.0*M_PI/lz;
-
-  Real &ex = expo;
-  Real &ex_prp = exp_prp;
-  Real &ex_prl = exp_prl;
-  Real norm, kprl, kprp, kiso;
-
-  int nmode = 0;
-  int nkx, nky, nkz, nsqr;
-  for (nkx = 0; nkx <= nhigh; nkx++) {
-    for (nky = 0; nky <= nhigh; nky++) {
-      for (nkz = 0; nkz <= nhigh; nkz++) {
-        if (nkx == 0 && nky == 0 && nkz == 0) continue;
-        norm = 0.0;
-        nsqr = 0.0;
-        bool flag_prl = true;
-        if (driving_type == 0) {
-          nsqr = SQR(nkx) + SQR(nky) + SQR(nkz);
-        } else if (driving_type == 1) {
-          nsqr = SQR(nkx) + SQR(nky);
-          Real nprlsqr = SQR(nkz);
-          if (nprlsqr >= nlow_sqr && nprlsqr <= nhigh_sqr) {
-            flag_prl = true;
-          } else {
-            flag_prl = false;
-          }
-        }
-        if (nsqr >= nlow_sqr && nsqr <= nhigh_sqr && flag_prl) {
-          kx = dkx*nkx;
-          ky = dky*nky;
-          kz = dkz*nkz;
-
-          // Generate Fourier amplitudes
-          if (driving_type == 0) {
-            kiso = sqrt(SQR(kx) + SQR(ky) + SQR(kz));
-            if (kiso > 1e-16) {
-              norm = 1.0/pow(kiso,(ex+2.0)/2.0);
-            } else {
-              norm = 0.0;
-            }
-            if (nkz != 0) {
-              ikz = 1.0/(dkz*((Real) nkz));
-
-              xccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xccs_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xcsc_.h_view(nmode) = (nky==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              xcss_.h_view(nmode) = (nky==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              xscc_.h_view(nmode) = (nkx==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              xscs_.h_view(nmode) = (nkx==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              xssc_.h_view(nmode) = (nkx==0 || nky==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xsss_.h_view(nmode) = (nkx==0 || nky==0) ? 0.0 : RanGaussianSt(&(rstate));
-
-              yccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              yccs_.h_view(nmode) = RanGaussianSt(&(rstate));
-              ycsc_.h_view(nmode) = (nky==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              ycss_.h_view(nmode) = (nky==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              yscc_.h_view(nmode) = (nkx==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              yscs_.h_view(nmode) = (nkx==0)           ? 0.0 : RanGaussianSt(&(rstate));
-              yssc_.h_view(nmode) = (nkx==0 || nky==0) ? 0.0 : RanGaussianSt(&(rstate));
-              ysss_.h_view(nmode) = (nkx==0 || nky==0) ? 0.0 : RanGaussianSt(&(rstate));
-
-              // imcompressibility
-              zccc_.h_view(nmode) =  ikz*( kx*xscs_.h_view(nmode)+ky*ycss_.h_view(nmode));
-              zccs_.h_view(nmode) = -ikz*( kx*xscc_.h_view(nmode)+ky*ycsc_.h_view(nmode));
-              zcsc_.h_view(nmode) =  ikz*( kx*xsss_.h_view(nmode)-ky*yccs_.h_view(nmode));
-              zcss_.h_view(nmode) =  ikz*(-kx*xssc_.h_view(nmode)+ky*yccc_.h_view(nmode));
-              zscc_.h_view(nmode) =  ikz*(-kx*xccs_.h_view(nmode)+ky*ysss_.h_view(nmode));
-              zscs_.h_view(nmode) =  ikz*( kx*xccc_.h_view(nmode)-ky*yssc_.h_view(nmode));
-              zssc_.h_view(nmode) = -ikz*( kx*xcss_.h_view(nmode)+ky*yscs_.h_view(nmode));
-              zsss_.h_view(nmode) =  ikz*( kx*xcsc_.h_view(nmode)+ky*yscc_.h_view(nmode));
-            } else if (nky != 0) {  // kz == 0
-              iky = 1.0/(dky*((Real) nky));
-
-              xccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xcsc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xscc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xssc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xccs_.h_view(nmode) = 0.0;
-              xscs_.h_view(nmode) = 0.0;
-              xcss_.h_view(nmode) = 0.0;
-              xsss_.h_view(nmode) = 0.0;
-
-              zccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              zcsc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              zscc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              zssc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              zccs_.h_view(nmode) = 0.0;
-              zcss_.h_view(nmode) = 0.0;
-              zscs_.h_view(nmode) = 0.0;
-              zsss_.h_view(nmode) = 0.0;
-
-              // incompressibility
-              yccc_.h_view(nmode) =  iky*kx*xssc_.h_view(nmode);
-              ycsc_.h_view(nmode) = -iky*kx*xscc_.h_view(nmode);
-              yscc_.h_view(nmode) = -iky*kx*xcsc_.h_view(nmode);
-              yssc_.h_view(nmode) =  iky*kx*xccc_.h_view(nmode);
-              yccs_.h_view(nmode) = 0.0;
-              ycss_.h_view(nmode) = 0.0;
-              yscs_.h_view(nmode) = 0.0;
-              ysss_.h_view(nmode) = 0.0;
-            } else {  // kz == ky == 0, kx != 0 by initial if statement
-              zccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              zscc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              zcsc_.h_view(nmode) = 0.0;
-              zssc_.h_view(nmode) = 0.0;
-              zccs_.h_view(nmode) = 0.0;
-              zcss_.h_view(nmode) = 0.0;
-              zscs_.h_view(nmode) = 0.0;
-              zsss_.h_view(nmode) = 0.0;
-
-              yccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              yscc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              ycsc_.h_view(nmode) = 0.0;
-              yssc_.h_view(nmode) = 0.0;
-              yccs_.h_view(nmode) = 0.0;
-              ycss_.h_view(nmode) = 0.0;
-              yscs_.h_view(nmode) = 0.0;
-              ysss_.h_view(nmode) = 0.0;
-
-              // incompressibility
-              xccc_.h_view(nmode) = 0.0;
-              xscc_.h_view(nmode) = 0.0;
-              xcsc_.h_view(nmode) = 0.0;
-              xssc_.h_view(nmode) = 0.0;
-              xccs_.h_view(nmode) = 0.0;
-              xscs_.h_view(nmode) = 0.0;
-              xcss_.h_view(nmode) = 0.0;
-              xsss_.h_view(nmode) = 0.0;
-            }
-          } else if (driving_type == 1) {
-            kprl = sqrt(SQR(kx));
-            kprp = sqrt(SQR(ky) + SQR(kz));
-            if (kprl > 1e-16 && kprp > 1e-16) {
-              norm = 1.0/pow(kprp,(ex_prp+1.0)/2.0)/pow(kprl,ex_prl/2.0);
-            } else {
-              norm = 0.0;
-            }
-
-            if (nky != 0) {
-              iky = 1.0/(dky*((Real) nky));
-
-              xccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xccs_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xcsc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xcss_.h_view(nmode) = RanGaussianSt(&(rstate));
-              xscc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xscs_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xssc_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-              xsss_.h_view(nmode) = (nkx==0) ? 0.0 : RanGaussianSt(&(rstate));
-
-              // incompressibility
-              yccc_.h_view(nmode) =  iky*(kx*xssc_.h_view(nmode));
-              yccs_.h_view(nmode) =  iky*(kx*xsss_.h_view(nmode));
-              ycsc_.h_view(nmode) = -iky*(kx*xscc_.h_view(nmode));
-              ycss_.h_view(nmode) = -iky*(kx*xscs_.h_view(nmode));
-              yscc_.h_view(nmode) = -iky*(kx*xcsc_.h_view(nmode));
-              yscs_.h_view(nmode) = -iky*(kx*xcss_.h_view(nmode));
-              yssc_.h_view(nmode) =  iky*(kx*xccc_.h_view(nmode));
-              ysss_.h_view(nmode) =  iky*(kx*xccs_.h_view(nmode));
-
-              zccc_.h_view(nmode) = 0.0;
-              zccs_.h_view(nmode) = 0.0;
-              zcsc_.h_view(nmode) = 0.0;
-              zcss_.h_view(nmode) = 0.0;
-              zscc_.h_view(nmode) = 0.0;
-              zscs_.h_view(nmode) = 0.0;
-              zssc_.h_view(nmode) = 0.0;
-              zsss_.h_view(nmode) = 0.0;
-            } else {  // ky == 0
-              yccc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              yscc_.h_view(nmode) = RanGaussianSt(&(rstate));
-              ycsc_.h_view(nmode) = 0.0;
-              yssc_.h_view(nmode) = 0.0;
-              yccs_.h_view(nmode) = 0.0;
-              ycss_.h_view(nmode) = 0.0;
-              yscs_.h_view(nmode) = 0.0;
-              ysss_.h_view(nmode) = 0.0;
-
-              // incompressibility
-              xccc_.h_view(nmode) = 0.0;
-              xscc_.h_view(nmode) = 0.0;
-              xcsc_.h_view(nmode) = 0.0;
-              xssc_.h_view(nmode) = 0.0;
-              xccs_.h_view(nmode) = 0.0;
-              xscs_.h_view(nmode) = 0.0;
-              xcss_.h_view(nmode) = 0.0;
-              xsss_.h_view(nmode) = 0.0;
-
-              zccc_.h_view(nmode) = 0.0;
-              zscc_.h_view(nmode) = 0.0;
-              zcsc_.h_view(nmode) = 0.0;
-              zssc_.h_view(nmode) = 0.0;
-              zccs_.h_view(nmode) = 0.0;
-              zcss_.h_view(nmode) = 0.0;
-              zscs_.h_view(nmode) = 0.0;
-              zsss_.h_view(nmode) = 0.0;
-            }
-          }
-          // normalization
-          xccc_.h_view(nmode) *= norm;
-          xscc_.h_view(nmode) *= norm;
-          xcsc_.h_view(nmode) *= norm;
-          xssc_.h_view(nmode) *= norm;
-          xccs_.h_view(nmode) *= norm;
-          xscs_.h_view(nmode) *= norm;
-          xcss_.h_view(nmode) *= norm;
-          xsss_.h_view(nmode) *= norm;
-          yccc_.h_view(nmode) *= norm;
-          yscc_.h_view(nmode) *= norm;
-          ycsc_.h_view(nmode) *= norm;
-          yssc_.h_view(nmode) *= norm;
-          yccs_.h_view(nmode) *= norm;
-          yscs_.h_view(nmode) *= norm;
-          ycss_.h_view(nmode) *= norm;
-          ysss_.h_view(nmode) *= norm;
-          zccc_.h_view(nmode) *= norm;
-          zscc_.h_view(nmode) *= norm;
-          zcsc_.h_view(nmode) *= norm;
-          zssc_.h_view(nmode) *= norm;
-          zccs_.h_view(nmode) *= norm;
-          zscs_.h_view(nmode) *= norm;
-          zcss_.h_view(nmode) *= norm;
-          zsss_.h_view(nmode) *= norm;
-
-          nmode++;
-        }
-      }
+  Real dkx = 2.0*M_PI/lx;
+  Real dky = 2.0*M_PI/ly;
+  Real dkz = 2.0*M_PI/lz;
+
+  int nlow_ = nlow, nhigh_ = nhigh, driving_type_ = driving_type;
+  Real ex = expo, ex_prp = exp_prp, ex_prl = exp_prl;
+
+  if (rng_on_device) {
+    // random stream lives on device; copy rstate there once (at start or after restart)
+    if (!rng_dvce_current) {
+      rng.h_view(0) = rstate;
+      rng.template modify<HostMemSpace>();
+      rng.template sync<DevExeSpace>();
+      rng_dvce_current = true;
     }
+    auto amp_ = amp.d_view;
+    auto rng_ = rng.d_view;
+    par_for("turb_amplitudes", DevExeSpace(), 0, 0,
+    KOKKOS_LAMBDA(int n) {
+      GenerateAmplitudes(amp_, &(rng_(0)), nlow_, nhigh_, driving_type_, dkx, dky, dkz,
+                         ex, ex_prp, ex_prl);
+    });
+    amp.template modify<DevExeSpace>();
+    rng.template modify<DevExeSpace>();
+  } else {
+    GenerateAmplitudes(amp.h_view, &(rstate), nlow_, nhigh_, driving_type_, dkx, dky, dkz,
+                       ex, ex_prp, ex_prl);
+    amp.template modify<HostMemSpace>();
+    amp.template sync<DevExeSpace>();
   }
 
-  xccc_.template modify<HostMemSpace>();
-  xccc_.template sync<DevExeSpace>();
-  xccs_.template modify<HostMemSpace>();
-  xccs_.template sync<DevExeSpace>();
-  xcsc_.template modify<HostMemSpace>();
-  xcsc_.template sync<DevExeSpace>();
-  xcss_.template modify<HostMemSpace>();
-  xcss_.template sync<DevExeSpace>();
-  xscc_.template modify<HostMemSpace>();
-  xscc_.template sync<DevExeSpace>();
-  xscs_.template modify<HostMemSpace>();
-  xscs_.template sync<DevExeSpace>();
-  xssc_.template modify<HostMemSpace>();
-  xssc_.template sync<DevExeSpace>();
-  xsss_.template modify<HostMemSpace>();
-  xsss_.template sync<DevExeSpace>();
-
-  yccc_.template modify<HostMemSpace>();
-  yccc_.template sync<DevExeSpace>();
-  yccs_.template modify<HostMemSpace>();
-  yccs_.template sync<DevExeSpace>();
-  ycsc_.template modify<HostMemSpace>();
-  ycsc_.template sync<DevExeSpace>();
-  ycss_.template modify<HostMemSpace>();
-  ycss_.template sync<DevExeSpace>();
-  yscc_.template modify<HostMemSpace>();
-  yscc_.template sync<DevExeSpace>();
-  yscs_.template modify<HostMemSpace>();
-  yscs_.template sync<DevExeSpace>();
-  yssc_.template modify<HostMemSpace>();
-  yssc_.template sync<DevExeSpace>();
-  ysss_.template modify<HostMemSpace>();
-  ysss_.template sync<DevExeSpace>();
-
-  zccc_.template modify<HostMemSpace>();
-  zccc_.template sync<DevExeSpace>();
-  zccs_.template modify<HostMemSpace>();
-  zccs_.template sync<DevExeSpace>();
-  zcsc_.template modify<HostMemSpace>();
-  zcsc_.template sync<DevExeSpace>();
-  zcss_.template modify<HostMemSpace>();
-  zcss_.template sync<DevExeSpace>();
-  zscc_.template modify<HostMemSpace>();
-  zscc_.template sync<DevExeSpace>();
-  zscs_.template modify<HostMemSpace>();
-  zscs_.template sync<DevExeSpace>();
-  zssc_.template modify<HostMemSpace>();
-  zssc_.template sync<DevExeSpace>();
-  zsss_.template modify<HostMemSpace>();
-  zsss_.template sync<DevExeSpace>();
-
   auto xcos_ = xcos;
   auto xsin_ = xsin;
   auto ycos_ = ycos;
   auto ysin_ = ysin;
   auto zcos_ = zcos;
   auto zsin_ = zsin;
+  auto amp_ = amp.d_view;
 
-  for (int n=0; n<mode_count_; n++) {
-    par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
-    KOKKOS_LAMBDA(int m, int k, int j, int i) {
-      force_tmp_(m,0,k,j,i) += xccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,0,k,j,i) += xsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,1,k,j,i) += yccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ycss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,1,k,j,i) += yssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,1,k,j,i) += ysss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-
-      force_tmp_(m,2,k,j,i) += zccc_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zccs_.d_view(n)*xcos_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcsc_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zcss_.d_view(n)*xcos_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscc_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zscs_.d_view(n)*xsin_(m,n,i)*ycos_(m,n,j)*zsin_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zssc_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zcos_(m,n,k);
-      force_tmp_(m,2,k,j,i) += zsss_.d_view(n)*xsin_(m,n,i)*ysin_(m,n,j)*zsin_(m,n,k);
-    });
-  }
+  // Sum over all modes in a single kernel, so each cell of the new force is written once.
+  // The separable factors are combined as (x*y)*z to reuse products over the z factors.
+  par_for("force_compute", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real f1 = 0.0, f2 = 0.0, f3 = 0.0;
+    for (int n=0; n<mode_count_; n++) {
+      Real cc = xcos_(m,n,i)*ycos_(m,n,j);
+      Real cs = xcos_(m,n,i)*ysin_(m,n,j);
+      Real sc = xsin_(m,n,i)*ycos_(m,n,j);
+      Real ss = xsin_(m,n,i)*ysin_(m,n,j);
+      Real ccc = cc*zcos_(m,n,k), ccs = cc*zsin_(m,n,k);
+      Real csc = cs*zcos_(m,n,k), css = cs*zsin_(m,n,k);
+      Real scc = sc*zcos_(m,n,k), scs = sc*zsin_(m,n,k);
+      Real ssc = ss*zcos_(m,n,k), sss = ss*zsin_(m,n,k);
+
+      f1 += amp_(n,XCCC)*ccc + amp_(n,XCCS)*ccs + amp_(n,XCSC)*csc
+          + amp_(n,XCSS)*css + amp_(n,XSCC)*scc + amp_(n,XSCS)*scs
+          + amp_(n,XSSC)*ssc + amp_(n,XSSS)*sss;
+      f2 += amp_(n,YCCC)*ccc + amp_(n,YCCS)*ccs + amp_(n,YCSC)*csc
+          + amp_(n,YCSS)*css + amp_(n,YSCC)*scc + amp_(n,YSCS)*scs
+          + amp_(n,YSSC)*ssc + amp_(n,YSSS)*sss;
+      f3 += amp_(n,ZCCC)*ccc + amp_(n,ZCCS)*ccs + amp_(n,ZCSC)*csc
+          + amp_(n,ZCSS)*css + amp_(n,ZSCC)*scc + amp_(n,ZSCS)*scs
+          + amp_(n,ZSSC)*ssc + amp_(n,ZSSS)*sss;
+    }
+    force_tmp_(m,0,k,j,i) = f1;
+    force_tmp_(m,1,k,j,i) = f2;
+    force_tmp_(m,2,k,j,i) = f3;
+  });
 
   DvceArray5D<Real> u0, u0_;
   if (pmy_pack->phydro != nullptr) u0 = (pmy_pack->phydro->u0);
@@ -712,48 +552,15 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   const int nmkji = nmb*nx3*nx2*nx1;
   const int nkji = nx3*nx2*nx1;
   const int nji  = nx2*nx1;
-  Real t0 = 0.0, t1 = 0.0, t2 = 0.0, t3 = 0.0;
-
-  Kokkos::parallel_reduce("net_mom_1", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
-  KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1,
-                                Real &sum_t2, Real &sum_t3) {
-    // compute n,k,j,i indices of thread
-    int m = (idx)/nkji;
-    int k = (idx - m*nkji)/nji;
-    int j = (idx - m*nkji - k*nji)/nx1;
-    int i = (idx - m*nkji - k*nji - j*nx1) + is;
-    k += ks;
-    j += js;
-    Real den = u0(m,IDN,k,j,i);
-    if (flag_twofl) {
-      den += u0_(m,IDN,k,j,i);
-    }
-    sum_t0 += den;
-    sum_t1 += den*force_tmp_(m,0,k,j,i);
-    sum_t2 += den*force_tmp_(m,1,k,j,i);
-    sum_t3 += den*force_tmp_(m,2,k,j,i);
-  }, Kokkos::Sum<Real>(t0), Kokkos::Sum<Real>(t1),
-     Kokkos::Sum<Real>(t2), Kokkos::Sum<Real>(t3));
-
-
-#if MPI_PARALLEL_ENABLED
-  Real m[4], gm[4];
-  m[0] = t0; m[1] = t1; m[2] = t2; m[3] = t3;
-  MPI_Allreduce(m, gm, 4, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  t0 = gm[0]; t1 = gm[1]; t2 = gm[2]; t3 = gm[3];
-#endif
-
-  par_for("force_remove_net_mom", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    force_tmp_(m,0,k,j,i) -= t1/t0;
-    force_tmp_(m,1,k,j,i) -= t2/t0;
-    force_tmp_(m,2,k,j,i) -= t3/t0;
-  });
-
-  t0 = 0.0;
-  t1 = 0.0;
-  Kokkos::parallel_reduce("net_mom_2", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
-  KOKKOS_LAMBDA(const int &idx, Real &sum_t0, Real &sum_t1) {
+  // All sums needed to remove the net momentum of the force and to normalize it are
+  // computed in one pass and reduced over ranks in one call.  With c = T/D the mean
+  // force (D = sum of den, T = sum of den*f), the sums over the corrected force f - c
+  // follow from the uncorrected ones:
+  //   sum den*|f-c|^2 = sum den*|f|^2 - |T|^2/D,   sum mom.(f-c) = sum mom.f - c.P
+  // where P = sum of mom.
+  array_sum::GlobalSum sum_this_pack;
+  Kokkos::parallel_reduce("net_mom", Kokkos::RangePolicy<>(DevExeSpace(),0,nmkji),
+  KOKKOS_LAMBDA(const int &idx, array_sum::GlobalSum &mb_sum) {
     // compute n,k,j,i indices of thread
     int m = (idx)/nkji;
     int k = (idx - m*nkji)/nji;
@@ -776,16 +583,33 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
     Real v2 = force_tmp_(m,1,k,j,i);
     Real v3 = force_tmp_(m,2,k,j,i);
 
-    sum_t0 += den*(v1*v1+v2*v2+v3*v3);
-    sum_t1 += mom1*v1+mom2*v2+mom3*v3;
-  }, Kokkos::Sum<Real>(t0), Kokkos::Sum<Real>(t1));
-
+    array_sum::GlobalSum fsum;
+    fsum.the_array[0] = den;
+    fsum.the_array[1] = den*v1;
+    fsum.the_array[2] = den*v2;
+    fsum.the_array[3] = den*v3;
+    fsum.the_array[4] = den*(v1*v1 + v2*v2 + v3*v3);
+    fsum.the_array[5] = mom1*v1 + mom2*v2 + mom3*v3;
+    fsum.the_array[6] = mom1;
+    fsum.the_array[7] = mom2;
+    fsum.the_array[8] = mom3;
+    mb_sum += fsum;
+  }, Kokkos::Sum<array_sum::GlobalSum>(sum_this_pack));
+
+  Real gsum[9];
+  for (int n=0; n<9; ++n) {
+    gsum[n] = sum_this_pack.the_array[n];
+  }
 #if MPI_PARALLEL_ENABLED
-  m[0] = t0; m[1] = t1;
-  MPI_Allreduce(m, gm, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  t0 = gm[0]; t1 = gm[1];
+  MPI_Allreduce(MPI_IN_PLACE, gsum, 9, MPI_ATHENA_REAL, MPI_SUM, MPI_COMM_WORLD);
 #endif
 
+  Real c1 = gsum[1]/gsum[0];
+  Real c2 = gsum[2]/gsum[0];
+  Real c3 = gsum[3]/gsum[0];
+  Real t0 = gsum[4] - (c1*gsum[1] + c2*gsum[2] + c3*gsum[3]);
+  Real t1 = gsum[5] - (c1*gsum[6] + c2*gsum[7] + c3*gsum[8]);
+
   t0 = std::max(t0, 1.0e-20);
   t1 = std::max(t1, 1.0e-20);
 
@@ -803,11 +627,12 @@ TaskStatus TurbulenceDriver::InitializeModes(Driver *pdrive, int stage) {
   }
   if (m0 == 0.0) s = 0.0;
 
+  // remove net momentum and normalize in one kernel
   par_for("force_norm", DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(int m, int k, int j, int i) {
-    force_tmp_(m,0,k,j,i) *= s;
-    force_tmp_(m,1,k,j,i) *= s;
-    force_tmp_(m,2,k,j,i) *= s;
+    force_tmp_(m,0,k,j,i) = (force_tmp_(m,0,k,j,i) - c1)*s;
+    force_tmp_(m,1,k,j,i) = (force_tmp_(m,1,k,j,i) - c2)*s;
+    force_tmp_(m,2,k,j,i) = (force_tmp_(m,2,k,j,i) - c3)*s;
   });
 
   return TaskStatus::complete;
@@ -25,11 +25,14 @@ class TurbulenceDriver {
   ~TurbulenceDriver();
 
   DvceArray5D<Real> force, force_tmp;  // arrays used for turb forcing
-  RNG_State rstate;                    // random state
+  RNG_State rstate;                    // random state (host copy, stored in restarts)
 
-  DualArray1D<Real> xccc, xccs, xcsc, xcss, xscc, xscs, xssc, xsss;
-  DualArray1D<Real> yccc, yccs, ycsc, ycss, yscc, yscs, yssc, ysss;
-  DualArray1D<Real> zccc, zccs, zcsc, zcss, zscc, zscs, zssc, zsss;
+  // indices of amplitudes of the 8 separable (cos/sin in x,y,z) terms of each force
+  // component, e.g. YCSC multiplies cos(kx x)*sin(ky y)*cos(kz z) in the y-force
+  enum {XCCC, XCCS, XCSC, XCSS, XSCC, XSCS, XSSC, XSSS,
+        YCCC, YCCS, YCSC, YCSS, YSCC, YSCS, YSSC, YSSS,
+        ZCCC, ZCCS, ZCSC, ZCSS, ZSCC, ZSCS, ZSSC, ZSSS, NAMP};
+  DualArray2D<Real> amp;               // amplitudes, dimensioned [mode_count, NAMP]
   DualArray1D<Real> kx_mode, ky_mode, kz_mode;
   DvceArray3D<Real> xcos, xsin, ycos, ysin, zcos, zsin;
 
@@ -39,6 +42,7 @@ class TurbulenceDriver {
   Real tcorr, dedt;
   Real expo, exp_prl, exp_prp;
   int driving_type;
+  bool rng_on_device;   // draw random amplitudes on device, never syncing them to host
 
   // functions
   void IncludeInitializeModesTask(std::shared_ptr<TaskList> tl, TaskID start);
@@ -46,10 +50,20 @@ class TurbulenceDriver {
   TaskStatus InitializeModes(Driver *pdrive, int stage);
   TaskStatus AddForcing(Driver *pdrive, int stage);
   void Initialize();
+  void SyncRNGStateToHost();
 
  private:
   bool first_time = true;   // flag to enable initialization on first call
+  bool rng_dvce_current = false;  // device RNG state up to date with rstate
+  DualArray1D<RNG_State> rng;     // copy of rstate used with rng_on_device
   MeshBlockPack *pmy_pack;  // ptr to MeshBlockPack containing this TurbulenceDriver
+
+  template <typename ViewType>
+  KOKKOS_INLINE_FUNCTION
+  static void GenerateAmplitudes(const ViewType &amp, RNG_State *prs,
+                                 const int nlow, const int nhigh, const int driving_type,
+                                 const Real dkx, const Real dky, const Real dkz,
+                                 const Real ex, const Real ex_prp, const Real ex_prl);
 };
 
 #endif  // SRCTERMS_TURB_DRIVER_HPP_
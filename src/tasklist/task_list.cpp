@@ -0,0 +1,47 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file task_list.cpp
+//  \brief implementation of TaskList::DoAvailable(), the only TaskList function that
+//  needs Kokkos (to time and fence tasks when profiling is enabled)
+
+#include <Kokkos_Core.hpp>
+
+#include "task_list.hpp"
+
+namespace {
+// timer used when profiling tasks.  Only differences of times are used.
+Kokkos::Timer task_clock;
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn TaskListStatus TaskList::DoAvailable()
+//! \brief cycle through task list once, do any tasks whose dependencies are clear
+
+TaskListStatus TaskList::DoAvailable(Driver *d, int s) {
+  for (auto &task : task_list_) {
+    auto dep = task.GetDependency();
+    if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
+      TaskStatus status;
+      if (profile_) {
+        // in precise mode fence so that asynchronous kernels are charged to the task
+        // that launched them
+        if (precise_) {Kokkos::fence();}
+        double t0 = task_clock.seconds();
+        status = task(d,s);
+        if (precise_) {Kokkos::fence();}
+        task.AddTime(t0, task_clock.seconds(), (status == TaskStatus::complete));
+      } else {
+        status = task(d,s);  // calls Task function using overloaded operator()
+      }
+      if (status == TaskStatus::complete) {
+        task.SetComplete();              // set bool flag in task
+        MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
+      }
+    }
+  }
+  if (IsComplete()) return TaskListStatus::complete;
+  return TaskListStatus::running;
+}
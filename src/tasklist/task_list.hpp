@@ -7,7 +7,7 @@
 //========================================================================================
 //!   \file task_list.hpp
 //    \brief provides functionality to control dynamic execution using tasks
-//           currently everything is implemented in this single header file
+//           everything except TaskList::DoAvailable() is implemented in this header
 //
 // The original idea and implementation of TaskLists was by Kengo Tomida
 // This version includes improvements due to Josh Dolence and the Parthenon dev team, and
@@ -15,10 +15,13 @@
 
 #include <iostream>
 #include <bitset>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <list>
 #include <iterator>
+#include <string>
+#include <utility>
 
 class Driver;
 
@@ -86,12 +89,14 @@ class TaskID {
 
 class Task {
  public:
-  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func) :
-  myid_(id), dep_(dep), func_(func) {}
+  Task(TaskID id, TaskID dep, std::function<TaskStatus(Driver*, int)> func,
+       std::string name="") :
+  myid_(id), dep_(dep), func_(func), name_(std::move(name)) {}
   // overloaded operator() calls task function
   TaskStatus operator()(Driver *d, int s) {return func_(d,s);}
   TaskID GetID() {return myid_;}
   TaskID GetDependency() {return dep_;}
+  const std::string &GetName() const {return name_;}
   void SetComplete() {complete_ = true;}
   void SetIncomplete() {complete_ = false;}
   bool IsComplete() {return complete_;}
@@ -100,12 +105,32 @@ class Task {
     if ((dep_ & id) == id) {dep_ = ((dep_ ^ id) | newdep);}
   }
 
+  // timing data, only accumulated when profiling is enabled in the TaskList
+  // Time waiting is measured from the first call that returned incomplete (e.g. a Recv
+  // task whose messages had not arrived) until the call that completed the task.
+  double run_time = 0.0;      // time spent inside task function (all calls)
+  double wait_time = 0.0;     // time between first incomplete call and completion
+  std::uint64_t ncomplete = 0;  // number of times task completed
+  void AddTime(double t0, double t1, bool done) {
+    run_time += (t1 - t0);
+    if (!(done)) {
+      if (wait_start_ < 0.0) {wait_start_ = t0;}
+    } else {
+      if (wait_start_ >= 0.0) {wait_time += (t1 - wait_start_);}
+      wait_start_ = -1.0;
+      ncomplete++;
+    }
+  }
+  void ResetTimers() {run_time = 0.0; wait_time = 0.0; ncomplete = 0; wait_start_ = -1.0;}
+
  private:
   TaskID myid_;    // encodes task ID in bitfld_
   TaskID dep_;     // encodes dependencies to other tasks in bitfld_
   // bool lb_time_;   // flag to include this task in timing for automatic load balancing
   bool complete_ = false;
   std::function<TaskStatus(Driver*, int)> func_;  // ptr to Task function
+  std::string name_;           // name used in profiling output
+  double wait_start_ = -1.0;   // time of first incomplete call (<0 when not waiting)
 };
 
 //----------------------------------------------------------------------------------------
@@ -135,6 +160,16 @@ class TaskList {
   void PrintIDs() { for (auto &it : task_list_) {it.GetID().PrintID();} }
   void PrintDependencies() { for (auto &it : task_list_) {it.GetDependency().PrintID();} }
 
+  // functions for profiling tasks
+  void EnableProfiling(bool precise) {profile_ = true; precise_ = precise;}
+  bool IsProfiled() const {return profile_;}
+  std::list<Task> &GetTasks() {return task_list_;}
+  double TotalRunTime() const {
+    double t = 0.0;
+    for (auto &it : task_list_) {t += it.run_time;}
+    return t;
+  }
+
   //
   void Reset() {
     tasks_completed_.Clear();  // TaskID Clear() fn
@@ -142,44 +177,32 @@ class TaskList {
   }
 
   // cycle through task list once, do any tasks whose dependencies are clear
-  TaskListStatus DoAvailable(Driver *d, int s) {
-    for (auto &task : task_list_) {
-      auto dep = task.GetDependency();
-      if ( tasks_completed_.CheckDependencies(dep) && !(task.IsComplete()) ) {
-        TaskStatus status = task(d,s);  // calls Task function using overloaded operator()
-        if (status == TaskStatus::complete) {
-          task.SetComplete();              // set bool flag in task
-          MarkTaskComplete(task.GetID());  // add TaskID to tasks_completed_
-        }
-      }
-    }
-    if (IsComplete()) return TaskListStatus::complete;
-    return TaskListStatus::running;
-  }
+  TaskListStatus DoAvailable(Driver *d, int s);
 
   // ADD new Task with ID, given dependency, and a pointer to a static or non-member
   // function to the end of task list.  Returns ID of new task. Task function must have
   // arguments (Driver*, int). Usage:
   //     taskid = tl.AddTask(DoSomething, dependency, name);
   template <class F>
-  TaskID AddTask(F func, TaskID &dep) {
+  TaskID AddTask(F func, TaskID &dep, std::string name="") {
     auto size = task_list_.size();
     TaskID id(size+1);
     task_list_.push_back(
-      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);}));
+      Task(id, dep, [=](Driver *d, int s) mutable -> TaskStatus {return func(d,s);},
+           name));
     return id;
   }
 
   // ADD new Task with ID, given dependency, and a pointer to a member function of
   // class T to the end of task list.  Returns ID of new task. Task function must have
-  // arguments (Driver*, int).  Usage:
+  // arguments (Driver*, int).  Optional name is used in profiling output.  Usage:
   //     taskid = tl.AddTask(&T::DoSomething, T, dependency);
   template <class F, class T>
-  TaskID AddTask(F func, T *obj, TaskID &dep) {
+  TaskID AddTask(F func, T *obj, TaskID &dep, std::string name="") {
     auto size = task_list_.size();
     TaskID id(size+1);
     task_list_.push_back( Task(id, dep,
-       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}) );
+       [=](Driver *d, int s) mutable -> TaskStatus {return (obj->*func)(d,s);}, name) );
     return id;
   }
 
@@ -187,10 +210,11 @@ class TaskList {
   // list. Returns ID of new task. Task function must have arguments (Driver*, int).
   // Usage:
   //      taskid = tl.AddTask(DoSomething, dependency);
-  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep) {
+  TaskID AddTask(std::function<TaskStatus(Driver*, int)> func, TaskID &dep,
+                 std::string name="") {
     auto size = task_list_.size();
     TaskID id(size+1);
-    task_list_.push_back(Task(id, dep, func));
+    task_list_.push_back(Task(id, dep, func, name));
     return id;
   }
 
@@ -223,6 +247,8 @@ class TaskList {
  protected:
   std::list<Task> task_list_;
   TaskID tasks_completed_;
+  bool profile_ = false;   // accumulate time spent in each task
+  bool precise_ = false;   // fence device before/after each task when profiling
 };
 
 #endif  // TASKLIST_TASK_LIST_HPP_
@@ -16,6 +16,7 @@
 #include "coordinates/cell_locations.hpp"
 #include "mesh/mesh.hpp"
 #include "coordinates/coordinates.hpp"
+#include "coordinates/adm.hpp"
 #include "cart_grid.hpp"
 
 //----------------------------------------------------------------------------------------
@@ -256,7 +257,8 @@ void CartesianGrid::SetInterpolationWeights() {
 //! \fn void CartesianGrid::InterpolateToGrid
 //! \brief interpolate Cartesian data to cart_grid for output
 
-void CartesianGrid::InterpolateToGrid(int ind, DvceArray5D<Real> &val) {
+template <typename TYPE>
+void CartesianGrid::InterpolateToGrid(int ind, TYPE &val) {
   // reinitialize interpolation indices and weights if AMR
   //if (pmy_pack->pmesh->adaptive) {
   //  SetInterpolationIndices();
@@ -308,4 +310,8 @@ void CartesianGrid::InterpolateToGrid(int ind, DvceArray5D<Real> &val) {
 
   return;
 }
+template void CartesianGrid::InterpolateToGrid<DvceArray5D<Real>>(int ind,
+    DvceArray5D<Real> &val);
+template void CartesianGrid::InterpolateToGrid<adm::ADM::ADM_view>(int ind,
+    adm::ADM::ADM_view &val);
 
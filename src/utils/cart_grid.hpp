@@ -36,7 +36,9 @@ class CartesianGrid {
 
   // For simplicity, unravell all points into a 1d array
   DualArray3D<Real> interp_vals;   // container for data interpolated to sphere
-  void InterpolateToGrid(int nvars, DvceArray5D<Real> &val);  // interpolate to sphere
+  // interpolate to grid; val is a DvceArray5D or a functor called as val(m,n,k,j,i)
+  template <typename TYPE>
+  void InterpolateToGrid(int nvars, TYPE &val);
   void ResetCenter(Real center[3]);  // set indexing for interpolation
   void SetInterpolationIndices();      // set indexing for interpolation
   void SetInterpolationWeights();      // set weights for interpolation
@@ -58,6 +58,7 @@ void ComputeDerivedVariable(std::string name, int index, MeshBlockPack* pmbp,
     auto nh_c_ = pmbp->prad->nh_c;
     auto tet_c_ = pmbp->prad->tet_c;
     auto tetcov_c_ = pmbp->prad->tetcov_c;
+    bool &tet_otf = pmbp->prad->tetrad_on_the_fly;
     auto domega = pmbp->prad->prgeo->solid_angles;
     auto i0_ = pmbp->prad->i0;
 
@@ -79,17 +80,21 @@ void ComputeDerivedVariable(std::string name, int index, MeshBlockPack* pmbp,
       Real glower[4][4], gupper[4][4];
       ComputeMetricAndInverse(x1v,x2v,x3v,flat,spin,glower,gupper);
 
+      // stored tetrad, or evaluated analytically with tetrad_on_the_fly
+      Real e[4][4], ecov[4][4];
+      CellTetrad(tet_c_,tetcov_c_,tet_otf,x1v,x2v,x3v,flat,spin,glower,m,k,j,i,e,ecov);
+
       // coordinate component n^0
-      Real n0 = tet_c_(m,0,0,k,j,i);
+      Real n0 = e[0][0];
 
       // set coordinate frame component
       dvars(m,index,k,j,i) = 0.0;
       for (int n=0; n<=nang1; ++n) {
         Real nmun1 = 0.0; Real nmun2 = 0.0; Real n_0 = 0.0;
         for (int d=0; d<4; ++d) {
-          nmun1 += tet_c_   (m,d,0,k,j,i)*nh_c_.d_view(n,d);
-          nmun2 += tet_c_   (m,d,0,k,j,i)*nh_c_.d_view(n,d);
-          n_0   += tetcov_c_(m,d,0,k,j,i)*nh_c_.d_view(n,d);
+          nmun1 += e[d][0]*nh_c_.d_view(n,d);
+          nmun2 += e[d][0]*nh_c_.d_view(n,d);
+          n_0   += ecov[d][0]*nh_c_.d_view(n,d);
         }
         dvars(m,index,k,j,i) += (nmun1*nmun2*(i0_(m,n,k,j,i)/(n0*n_0))*domega.d_view(n));
       }
@@ -0,0 +1,426 @@
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sampled_id.cpp
+//  \brief implements SampledInitialData class
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "athena.hpp"
+#include "globals.hpp"
+#include "parameter_input.hpp"
+#include "coordinates/cell_locations.hpp"
+#include "mesh/mesh.hpp"
+#include "sampled_id.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
+namespace {
+//----------------------------------------------------------------------------------------
+//! \fn void ForEachRun()
+//  \brief Calls f(g,l,len) for each run of len consecutive sample points that lie both in
+//  the local block blk of box ib and in the range [pb,pe) of global indices, where g and
+//  l are the global and local indices of the first point of the run.  Sender and
+//  receiver visit the runs in the same order, so no indices need to be exchanged.
+
+template <typename F>
+void ForEachRun(const int *blk, int ib, int npts, int pb, int pe, F f) {
+  if (blk[3]*blk[4]*blk[5] == 0) return;
+  int nbpts = npts*npts*npts;
+  int gb = std::max(pb - ib*nbpts, 0);
+  int ge = std::min(pe - ib*nbpts, nbpts);
+  if (gb >= ge) return;
+  int kb = std::max(blk[2], gb/(npts*npts));
+  int ke = std::min(blk[2] + blk[5] - 1, (ge - 1)/(npts*npts));
+  for (int k=kb; k<=ke; ++k) {
+    for (int j=blk[1]; j<blk[1]+blk[4]; ++j) {
+      int r0 = (k*npts + j)*npts + blk[0];
+      int s0 = std::max(r0, gb);
+      int s1 = std::min(r0 + blk[3], ge);
+      if (s0 < s1) {
+        f(ib*nbpts + s0, blk[6] + ((k - blk[2])*blk[4] + (j - blk[1]))*blk[3] + (s0 - r0),
+          s1 - s0);
+      }
+    }
+  }
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+// constructor, reads parameters, sets up boxes and allocates storage for samples
+
+SampledInitialData::SampledInitialData(ParameterInput *pin, Mesh *pm, int nv,
+                                       const std::vector<std::array<Real,3>> &stars) :
+    nvar(nv), nlev(1), nbox(1), order(4), extent(0.0), star_extent(0.0), limit_tol(0.0),
+    ntotal(0), pbeg(0), pend(0), nlocal(0),
+    values("id_values",1,1),
+    samples("id_samples",1,1),
+    box("id_boxes",1,1),
+    block("id_blocks",1,1),
+    limit("id_limit",1) {
+  npts = pin->GetOrAddInteger("problem", "id_sample_npts", 0);
+  enabled = (npts > 0);
+  if (!enabled) return;
+
+  nlev = pin->GetOrAddInteger("problem", "id_sample_nlevels", 1);
+  order = pin->GetOrAddInteger("problem", "id_sample_order", 4);
+  // by default the outermost box covers the whole mesh, including ghost zones
+  auto &ms = pm->mesh_size;
+  Real xmax = std::max({std::abs(ms.x1min), std::abs(ms.x1max), std::abs(ms.x2min),
+                        std::abs(ms.x2max), std::abs(ms.x3min), std::abs(ms.x3max)});
+  extent = pin->GetOrAddReal("problem", "id_sample_extent", 1.1*xmax);
+  star_extent = pin->GetOrAddReal("problem", "id_sample_star_extent", 0.5*extent);
+  limit_tol = pin->GetOrAddReal("problem", "id_sample_limit_tol", 0.1);
+
+  if (order != 2 && order != 4) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<problem>/id_sample_order = " << order
+              << " not supported. Valid choices are [2,4]." << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  if (npts < order || nlev < 1) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "<problem>/id_sample_npts must be at least "
+              << "id_sample_order, and id_sample_nlevels at least 1" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+
+  // boxes are ordered from coarsest to finest: box 0 is centered at the origin, and box
+  // 1+(l-1)*ncen+s on level l>0 is centered on star s (or the origin if there are none)
+  std::vector<std::array<Real,3>> centers(stars);
+  if (centers.empty()) {
+    centers.push_back({0.0, 0.0, 0.0});
+  }
+  int ncen = static_cast<int>(centers.size());
+  nbox = 1 + ncen*(nlev - 1);
+
+  int64_t nsamp = static_cast<int64_t>(nbox)*npts*npts*npts;
+  if (nsamp*nvar > INT_MAX) {
+    std::cout << "### FATAL ERROR in " << __FILE__ << " at line " << __LINE__
+              << std::endl << "Too many initial data sample points, reduce "
+              << "<problem>/id_sample_npts or id_sample_nlevels" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+  ntotal = static_cast<int>(nsamp);
+
+  // divide evaluation of sample points evenly among ranks
+  int64_t nranks = global_variable::nranks;
+  int64_t rank = global_variable::my_rank;
+  pbeg = static_cast<int>((rank*nsamp)/nranks);
+  pend = static_cast<int>(((rank+1)*nsamp)/nranks);
+  Kokkos::realloc(values, nvar, pend - pbeg);
+
+  Kokkos::realloc(limit, nvar);
+  for (int n=0; n<nvar; ++n) {
+    limit.h_view(n) = 0;
+  }
+
+  Kokkos::realloc(box, nbox, 4);
+  box.h_view(0,0) = 0.0;
+  box.h_view(0,1) = 0.0;
+  box.h_view(0,2) = 0.0;
+  box.h_view(0,3) = extent;
+  for (int l=1; l<nlev; ++l) {
+    for (int s=0; s<ncen; ++s) {
+      int ib = 1 + (l-1)*ncen + s;
+      for (int d=0; d<3; ++d) {
+        box.h_view(ib,d) = centers[s][d];
+      }
+      box.h_view(ib,3) = star_extent/static_cast<Real>(1 << (l-1));
+    }
+  }
+  box.template modify<HostMemSpace>();
+  box.template sync<DevExeSpace>();
+
+  // Block of points in each box needed by the stencils at all cells (including ghost
+  // zones) of the MeshBlocks on this rank, stored as [lo1,lo2,lo3,n1,n2,n3,offset].
+  // Stencils in box 0 are clamped to the box, as in InterpolateToMesh().
+  auto &indcs = pm->mb_indcs;
+  auto &size = pm->pmb_pack->pmb->mb_size;
+  int nmb = pm->pmb_pack->nmb_thispack;
+  int nx[3] = {indcs.nx1, indcs.nx2, indcs.nx3};
+  Kokkos::realloc(block, nbox, 7);
+  for (int ib=0; ib<nbox; ++ib) {
+    Real h = box.h_view(ib,3);
+    Real dx = 2.0*h/static_cast<Real>(npts - 1);
+    int lo[3] = {npts, npts, npts}, hi[3] = {-1, -1, -1};
+    for (int m=0; m<nmb; ++m) {
+      Real xmin[3] = {size.h_view(m).x1min, size.h_view(m).x2min, size.h_view(m).x3min};
+      Real xmax[3] = {size.h_view(m).x1max, size.h_view(m).x2max, size.h_view(m).x3max};
+      int mlo[3], mhi[3];
+      bool overlaps = true;
+      for (int d=0; d<3; ++d) {
+        Real ghost = (nx[d] > 1)? indcs.ng*(xmax[d] - xmin[d])/nx[d] : 0.0;
+        Real slo = (xmin[d] - ghost - box.h_view(ib,d) + h)/dx;
+        Real shi = (xmax[d] + ghost - box.h_view(ib,d) + h)/dx;
+        slo = std::min(std::max(slo, static_cast<Real>(-1)), static_cast<Real>(npts));
+        shi = std::min(std::max(shi, static_cast<Real>(-1)), static_cast<Real>(npts));
+        mlo[d] = static_cast<int>(std::floor(slo)) - (order/2 - 1);
+        mhi[d] = static_cast<int>(std::floor(shi)) - (order/2 - 1);
+        if (ib == 0) {
+          mlo[d] = std::min(std::max(mlo[d], 0), npts - order);
+          mhi[d] = std::min(std::max(mhi[d], 0), npts - order);
+        } else {
+          mlo[d] = std::max(mlo[d], 0);
+          mhi[d] = std::min(mhi[d], npts - order);
+        }
+        if (mlo[d] > mhi[d]) overlaps = false;
+        mhi[d] += order - 1;
+      }
+      if (overlaps) {
+        for (int d=0; d<3; ++d) {
+          lo[d] = std::min(lo[d], mlo[d]);
+          hi[d] = std::max(hi[d], mhi[d]);
+        }
+      }
+    }
+    int ncount = 1;
+    for (int d=0; d<3; ++d) {
+      block.h_view(ib,d) = lo[d];
+      block.h_view(ib,3+d) = std::max(hi[d] - lo[d] + 1, 0);
+      ncount *= block.h_view(ib,3+d);
+    }
+    block.h_view(ib,6) = nlocal;
+    nlocal += ncount;
+  }
+  block.template modify<HostMemSpace>();
+  block.template sync<DevExeSpace>();
+
+  Kokkos::realloc(samples, nvar, nlocal);
+  if (global_variable::my_rank == 0) {
+    std::cout << "Sampling initial data at " << ntotal << " points in " << nbox
+              << " boxes around " << ncen << " centers" << std::endl;
+  }
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SampledInitialData::SampleCoordinates()
+//  \brief Returns coordinates of sample point p, with points ordered as [box,k,j,i]
+
+void SampledInitialData::SampleCoordinates(int p, Real &x, Real &y, Real &z) const {
+  int i = p % npts;
+  int j = (p/npts) % npts;
+  int k = (p/(npts*npts)) % npts;
+  int ib = p/(npts*npts*npts);
+  Real h = box.h_view(ib,3);
+  Real dx = 2.0*h/static_cast<Real>(npts - 1);
+  x = box.h_view(ib,0) - h + i*dx;
+  y = box.h_view(ib,1) - h + j*dx;
+  z = box.h_view(ib,2) - h + k*dx;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SampledInitialData::Gather()
+//  \brief Sends the samples evaluated on this rank to the ranks whose MeshBlocks need
+//  them, stores the samples received in the local blocks, and copies them to the device
+
+void SampledInitialData::Gather() {
+  int nranks = global_variable::nranks;
+  std::vector<int> blocks(nranks*nbox*7);
+#if MPI_PARALLEL_ENABLED
+  MPI_Allgather(block.h_view.data(), nbox*7, MPI_INT, blocks.data(), nbox*7, MPI_INT,
+                MPI_COMM_WORLD);
+#else
+  std::copy(block.h_view.data(), block.h_view.data() + nbox*7, blocks.begin());
+#endif
+  const int *myblock = block.h_view.data();
+
+  // count points sent to and received from each rank
+  std::vector<int> scount(nranks, 0), sdispl(nranks, 0);
+  std::vector<int> rcount(nranks, 0), rdispl(nranks, 0);
+  for (int r=0; r<nranks; ++r) {
+    int rb = static_cast<int>((static_cast<int64_t>(r)*ntotal)/nranks);
+    int re = static_cast<int>((static_cast<int64_t>(r+1)*ntotal)/nranks);
+    for (int ib=0; ib<nbox; ++ib) {
+      ForEachRun(&(blocks[(r*nbox + ib)*7]), ib, npts, pbeg, pend,
+                 [&](int g, int l, int len) { scount[r] += nvar*len; });
+      ForEachRun(myblock + ib*7, ib, npts, rb, re,
+                 [&](int g, int l, int len) { rcount[r] += nvar*len; });
+    }
+    if (r > 0) {
+      sdispl[r] = sdispl[r-1] + scount[r-1];
+      rdispl[r] = rdispl[r-1] + rcount[r-1];
+    }
+  }
+
+  // pack points needed by each rank, with all variables of a point stored together
+  std::vector<Real> sbuf(sdispl[nranks-1] + scount[nranks-1]);
+  std::vector<Real> rbuf(rdispl[nranks-1] + rcount[nranks-1]);
+  for (int r=0; r<nranks; ++r) {
+    int ip = sdispl[r];
+    for (int ib=0; ib<nbox; ++ib) {
+      ForEachRun(&(blocks[(r*nbox + ib)*7]), ib, npts, pbeg, pend,
+                 [&](int g, int l, int len) {
+        for (int q=0; q<len; ++q) {
+          for (int n=0; n<nvar; ++n) {
+            sbuf[ip++] = values(n, g + q - pbeg);
+          }
+        }
+      });
+    }
+  }
+#if MPI_PARALLEL_ENABLED
+  MPI_Alltoallv(sbuf.data(), scount.data(), sdispl.data(), MPI_ATHENA_REAL,
+                rbuf.data(), rcount.data(), rdispl.data(), MPI_ATHENA_REAL,
+                MPI_COMM_WORLD);
+#else
+  rbuf = sbuf;
+#endif
+
+  // unpack points into the local blocks
+  for (int r=0; r<nranks; ++r) {
+    int rb = static_cast<int>((static_cast<int64_t>(r)*ntotal)/nranks);
+    int re = static_cast<int>((static_cast<int64_t>(r+1)*ntotal)/nranks);
+    int ip = rdispl[r];
+    for (int ib=0; ib<nbox; ++ib) {
+      ForEachRun(myblock + ib*7, ib, npts, rb, re, [&](int g, int l, int len) {
+        for (int q=0; q<len; ++q) {
+          for (int n=0; n<nvar; ++n) {
+            samples.h_view(n, l + q) = rbuf[ip++];
+          }
+        }
+      });
+    }
+  }
+  samples.template modify<HostMemSpace>();
+  samples.template sync<DevExeSpace>();
+  return;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void SampledInitialData::InterpolateToMesh()
+//  \brief Interpolates samples to all cells (including ghost zones) of all MeshBlocks in
+//  the pack.  Output is dimensioned [nvar,nmb,ncells3,ncells2,ncells1], so that each
+//  variable is stored contiguously in the same order as the cells are usually looped.
+
+void SampledInitialData::InterpolateToMesh(MeshBlockPack *pmbp, DvceArray5D<Real> &out) {
+  auto &indcs = pmbp->pmesh->mb_indcs;
+  int &is = indcs.is, &js = indcs.js, &ks = indcs.ks;
+  int &nx1 = indcs.nx1, &nx2 = indcs.nx2, &nx3 = indcs.nx3;
+  int ncells1 = indcs.nx1 + 2*(indcs.ng);
+  int ncells2 = (indcs.nx2 > 1)? (indcs.nx2 + 2*(indcs.ng)) : 1;
+  int ncells3 = (indcs.nx3 > 1)? (indcs.nx3 + 2*(indcs.ng)) : 1;
+  int nmb = pmbp->nmb_thispack;
+  Kokkos::realloc(out, nvar, nmb, ncells3, ncells2, ncells1);
+
+  limit.template modify<HostMemSpace>();
+  limit.template sync<DevExeSpace>();
+
+  auto &size = pmbp->pmb->mb_size;
+  auto samp = samples.d_view;
+  auto bx = box.d_view;
+  auto blk = block.d_view;
+  auto lim = limit.d_view;
+  int nvar_ = nvar, npts_ = npts, nbox_ = nbox, nord = order;
+  Real tol = limit_tol;
+
+  par_for("sampled_id", DevExeSpace(), 0,nmb-1, 0,ncells3-1, 0,ncells2-1, 0,ncells1-1,
+  KOKKOS_LAMBDA(int m, int k, int j, int i) {
+    Real xp[3];
+    xp[0] = CellCenterX(i-is, nx1, size.d_view(m).x1min, size.d_view(m).x1max);
+    xp[1] = CellCenterX(j-js, nx2, size.d_view(m).x2min, size.d_view(m).x2max);
+    xp[2] = CellCenterX(k-ks, nx3, size.d_view(m).x3min, size.d_view(m).x3max);
+
+    // find finest box containing full stencil (stencil clamped to outermost box)
+    int ib = 0;
+    int i0[3];
+    Real t[3];
+    for (int b=nbox_-1; b>=0; --b) {
+      Real h = bx(b,3);
+      Real dx = 2.0*h/static_cast<Real>(npts_ - 1);
+      bool fits = true;
+      for (int d=0; d<3; ++d) {
+        Real s = (xp[d] - bx(b,d) + h)/dx;
+        i0[d] = static_cast<int>(floor(s)) - (nord/2 - 1);
+        t[d] = s - i0[d];
+        if (i0[d] < 0 || i0[d] + nord > npts_) fits = false;
+      }
+      if (fits || b == 0) {
+        ib = b;
+        break;
+      }
+    }
+    for (int d=0; d<3; ++d) {
+      if (i0[d] < 0 || i0[d] + nord > npts_) {
+        int ic = (i0[d] < 0)? 0 : npts_ - nord;
+        t[d] += i0[d] - ic;
+        i0[d] = ic;
+      }
+    }
+
+    // Lagrange weights in each direction
+    Real w[3][4];
+    for (int d=0; d<3; ++d) {
+      for (int a=0; a<nord; ++a) {
+        w[d][a] = 1.0;
+        for (int b=0; b<nord; ++b) {
+          if (b != a) w[d][a] *= (t[d] - b)/static_cast<Real>(a - b);
+        }
+      }
+    }
+
+    // position of stencil in block of box stored on this rank
+    int l0 = i0[0] - blk(ib,0), l1 = i0[1] - blk(ib,1), l2 = i0[2] - blk(ib,2);
+    int n0 = blk(ib,3), n1 = blk(ib,4), off = blk(ib,6);
+    for (int n=0; n<nvar_; ++n) {
+      Real q[4][4][4];
+      Real val = 0.0;
+      for (int c=0; c<nord; ++c) {
+        for (int b=0; b<nord; ++b) {
+          for (int a=0; a<nord; ++a) {
+            q[c][b][a] = samp(n, off + ((l2 + c)*n1 + l1 + b)*n0 + l0 + a);
+            val += w[2][c]*w[1][b]*w[0][a]*q[c][b][a];
+          }
+        }
+      }
+      // Limit hydro fields where the stencil straddles a discontinuity (e.g. the stellar
+      // surface), detected by second differences of the samples comparable to the
+      // samples themselves.  Smooth extrema, such as the stellar center, are kept.
+      if (lim(n) != 0 && nord > 2) {
+        Real qmax = 0.0, d2max = 0.0;
+        for (int c=0; c<nord; ++c) {
+          for (int b=0; b<nord; ++b) {
+            for (int a=0; a<nord; ++a) {
+              qmax = fmax(qmax, fabs(q[c][b][a]));
+              if (a > 0 && a < nord-1) {
+                d2max = fmax(d2max, fabs(q[c][b][a-1] - 2.0*q[c][b][a] + q[c][b][a+1]));
+              }
+              if (b > 0 && b < nord-1) {
+                d2max = fmax(d2max, fabs(q[c][b-1][a] - 2.0*q[c][b][a] + q[c][b+1][a]));
+              }
+              if (c > 0 && c < nord-1) {
+                d2max = fmax(d2max, fabs(q[c-1][b][a] - 2.0*q[c][b][a] + q[c+1][b][a]));
+              }
+            }
+          }
+        }
+        if (d2max > tol*qmax) {
+          // bound by the 8 samples nearest to the point
+          Real vmin = q[nord/2-1][nord/2-1][nord/2-1];
+          Real vmax = vmin;
+          for (int c=nord/2-1; c<=nord/2; ++c) {
+            for (int b=nord/2-1; b<=nord/2; ++b) {
+              for (int a=nord/2-1; a<=nord/2; ++a) {
+                vmin = fmin(vmin, q[c][b][a]);
+                vmax = fmax(vmax, q[c][b][a]);
+              }
+            }
+          }
+          val = fmin(fmax(val, vmin), vmax);
+        }
+      }
+      out(n,m,k,j,i) = val;
+    }
+  });
+  return;
+}
@@ -0,0 +1,70 @@
+#ifndef UTILS_SAMPLED_ID_HPP_
+#define UTILS_SAMPLED_ID_HPP_
+//========================================================================================
+// AthenaXXX astrophysical plasma code
+// Copyright(C) 2020 James M. Stone <jmstone@ias.edu> and the Athena code team
+// Licensed under the 3-clause BSD License (the "LICENSE")
+//========================================================================================
+//! \file sampled_id.hpp
+//  \brief defines SampledInitialData class, which stores external initial data sampled
+//  on a hierarchy of nested Cartesian boxes and interpolates it to the mesh on device
+
+#include <array>
+#include <vector>
+
+#include "athena.hpp"
+#include "parameter_input.hpp"
+
+// Forward declarations
+class Mesh;
+class MeshBlockPack;
+
+//----------------------------------------------------------------------------------------
+//! \class SampledInitialData
+//  \brief Import path for initial data computed by external (host-only) libraries.
+//  Rather than calling the external interpolator at every cell of every MeshBlock, the
+//  data is evaluated once at the points of a set of nested boxes with npts points per
+//  direction.  Box 0 is centered at the origin with half-width extent.  Each of the
+//  nlev-1 finer levels has one box centered on each star, with half-width
+//  star_extent/2^(l-1); without stars these boxes are centered at the origin.
+//  Evaluation of the sample points is divided among all ranks, and each rank then
+//  receives only the samples needed by the stencils of its own MeshBlocks.  The samples
+//  are interpolated to the cells with Lagrange polynomials in a single device kernel,
+//  using the finest box that contains the full stencil.  Variables flagged in limit
+//  (the hydro fields) are bounded by the 8 nearest samples where the stencil straddles
+//  a discontinuity, so no new extrema appear at stellar surfaces.  Enabled with
+//  <problem>/id_sample_npts > 0.
+//
+//  Usage: evaluate the external data at SampleCoordinates(p) for pbeg <= p < pend and
+//  store it in values(var,p-pbeg), then call Gather() and InterpolateToMesh().
+
+class SampledInitialData {
+ public:
+  SampledInitialData(ParameterInput *pin, Mesh *pm, int nvar,
+                     const std::vector<std::array<Real,3>> &stars);
+  ~SampledInitialData() = default;
+
+  bool enabled;       // flag set by <problem>/id_sample_npts > 0
+  int nvar;           // number of variables
+  int npts;           // number of points per direction in each box
+  int nlev;           // number of box levels
+  int nbox;           // total number of boxes
+  int order;          // number of points in interpolation stencil (2 or 4)
+  Real extent;        // half-width of outermost box
+  Real star_extent;   // half-width of first level of boxes around each star
+  Real limit_tol;     // threshold of discontinuity detector used by limiter
+  int ntotal;         // total number of sample points (over all boxes)
+  int pbeg, pend;     // range of sample points evaluated on this rank
+  int nlocal;         // number of sample points stored on this rank
+  HostArray2D<Real> values;   // samples evaluated on this rank, [nvar, pend-pbeg]
+  DualArray2D<Real> samples;  // samples needed on this rank, [nvar, nlocal]
+  DualArray2D<Real> box;      // center and half-width of each box, [nbox, 4]
+  DualArray2D<int> block;     // local block of points in each box, [nbox, 7]
+  DualArray1D<int> limit;     // set to 1 for variables limited at discontinuities
+
+  void SampleCoordinates(int p, Real &x, Real &y, Real &z) const;
+  void Gather();
+  void InterpolateToMesh(MeshBlockPack *pmbp, DvceArray5D<Real> &out);
+};
+
+#endif // UTILS_SAMPLED_ID_HPP_
@@ -16,16 +16,33 @@
 
 using namespace TableReader; // NOLINT
 
-Table::Table() : ndim(0), npoints(0), mem_size(0), initialized(false) {
+Table::Table() : data(nullptr), ndim(0), npoints(0), mem_size(0), header_size(0),
+                 initialized(false) {
+#if MPI_PARALLEL_ENABLED
+  shared = false;
+#endif
 }
 
 Table::~Table() {
   if (initialized) {
+#if MPI_PARALLEL_ENABLED
+    if (shared) {
+      MPI_Win_free(&win);
+      return;
+    }
+#endif
     delete[] data;
   }
 }
 
-ReadResult Table::ReadTable(const std::string fname) {
+ReadResult Table::ReadTable(const std::string fname, bool node_shared) {
+#if MPI_PARALLEL_ENABLED
+  int mpi_initialized = 0;
+  MPI_Initialized(&mpi_initialized);
+  if (node_shared && mpi_initialized) {
+    return ReadTableShared(fname);
+  }
+#endif
   ReadResult result;
 
   std::ifstream file;
@@ -50,14 +67,164 @@ ReadResult Table::ReadTable(const std::string fname) {
     return result;
   }
 
-  // HEADER PARSING
+  result = ReadHeader(file);
+  file.close();
+  if (result.error != ReadResult::SUCCESS) {
+    return result;
+  }
+
+  // Allocate memory for the fields.
+  data = new double[mem_size];
+  SetFieldPointers();
+  initialized = true;
+
+  return ReadData(fname);
+}
+
+#if MPI_PARALLEL_ENABLED
+// broadcasts error code and message of a ReadResult from rank 0 of comm
+namespace {
+void BcastResult(ReadResult& result, MPI_Comm comm) {
+  int code = static_cast<int>(result.error);
+  int len = result.message.size();
+  MPI_Bcast(&code, 1, MPI_INT, 0, comm);
+  MPI_Bcast(&len, 1, MPI_INT, 0, comm);
+  result.error = static_cast<ReadResult::ErrorCode>(code);
+  result.message.resize(len);
+  if (len > 0) {
+    MPI_Bcast(&result.message[0], len, MPI_CHAR, 0, comm);
+  }
+}
+
+// frees a window stored as an attribute of MPI_COMM_SELF, called in MPI_Finalize
+int FreeNodeSharedWindow(MPI_Comm comm, int keyval, void *attr, void *extra) {
+  MPI_Win *pwin = static_cast<MPI_Win*>(attr);
+  MPI_Win_free(pwin);
+  delete pwin;
+  MPI_Comm_free_keyval(&keyval);
+  return MPI_SUCCESS;
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------
+//! \fn ReadResult Table::ReadTableShared()
+//! \brief Only rank 0 of each node opens the file.  It sends the text header to the other
+//! ranks on the node, which parse it themselves, and reads the binary data into a shared
+//! memory window that all ranks on the node map.  Must be called by all ranks.
+
+ReadResult Table::ReadTableShared(const std::string fname) {
+  ReadResult result;
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &node_comm);
+  int node_rank;
+  MPI_Comm_rank(node_comm, &node_rank);
+
+  // Node leader parses the header, and keeps a copy of its text for the other ranks.
+  std::string header;
+  if (node_rank == 0) {
+    std::ifstream file(fname.c_str(), std::ifstream::in | std::ifstream::binary);
+    if (!file.is_open()) {
+      result.error = ReadResult::BAD_FILENAME;
+      std::stringstream ss;
+      ss << "ReadTable() failed to open '" << fname << "'\n";
+      result.message = ss.str();
+    } else {
+      result = ReadHeader(file);
+      if (result.error == ReadResult::SUCCESS) {
+        header.resize(header_size);
+        file.clear();
+        file.seekg(0);
+        file.read(&header[0], header_size);
+      }
+      file.close();
+    }
+  }
+  BcastResult(result, node_comm);
+  if (result.error != ReadResult::SUCCESS) {
+    MPI_Comm_free(&node_comm);
+    return result;
+  }
+
+  size_t hsize = header.size();
+  MPI_Bcast(&hsize, sizeof(size_t), MPI_BYTE, 0, node_comm);
+  if (node_rank != 0) {
+    header.resize(hsize);
+  }
+  MPI_Bcast(&header[0], hsize, MPI_CHAR, 0, node_comm);
+  if (node_rank != 0) {
+    std::istringstream hstream(header);
+    result = ReadHeader(hstream);
+  }
+
+  // Allocate the fields in a window owned by the node leader, then map it everywhere.
+  MPI_Aint wsize = (node_rank == 0)? mem_size*sizeof(double) : 0;
+  MPI_Win_allocate_shared(wsize, sizeof(double), MPI_INFO_NULL, node_comm, &data, &win);
+  if (node_rank != 0) {
+    int disp_unit;
+    MPI_Win_shared_query(win, 0, &wsize, &disp_unit, &data);
+  }
+  SetFieldPointers();
+  shared = true;
+  initialized = true;
+
+  if (node_rank == 0) {
+    result = ReadData(fname);
+  }
+  // all ranks wait until the leader has filled the window
+  MPI_Win_fence(0, win);
+  BcastResult(result, node_comm);
+  MPI_Comm_free(&node_comm);
+
+  return result;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void * TableReader::AllocateNodeShared()
+//! \brief Allocates memory in a window shared by all ranks on a node.  Since objects that
+//! alias it may be copied freely (e.g. into Kokkos kernels), the window is not owned by
+//! any of them, and is instead attached to MPI_COMM_SELF so that it is freed when the
+//! attribute is deleted at the start of MPI_Finalize.
+
+void * TableReader::AllocateNodeShared(size_t nbytes, bool& leader, MPI_Win& win) {
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+                      &node_comm);
+  int node_rank;
+  MPI_Comm_rank(node_comm, &node_rank);
+  leader = (node_rank == 0);
+
+  void *ptr;
+  MPI_Win *pwin = new MPI_Win;
+  MPI_Aint wsize = leader? nbytes : 0;
+  MPI_Win_allocate_shared(wsize, 1, MPI_INFO_NULL, node_comm, &ptr, pwin);
+  if (!(leader)) {
+    int disp_unit;
+    MPI_Win_shared_query(*pwin, 0, &wsize, &disp_unit, &ptr);
+  }
+  MPI_Comm_free(&node_comm);
+
+  int keyval;
+  MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, FreeNodeSharedWindow, &keyval, nullptr);
+  MPI_Comm_set_attr(MPI_COMM_SELF, keyval, pwin);
+  win = *pwin;
+  return ptr;
+}
+#endif
+
+//----------------------------------------------------------------------------------------
+//! \fn ReadResult Table::ReadHeader()
+//! \brief Parses the text header (metadata, scalars, points, and fields blocks), and sets
+//! the table dimensions and header size.
+
+ReadResult Table::ReadHeader(std::istream& file) {
+  ReadResult result;
 
   // Read in the metadata
   std::vector<std::string> block_lines;
 
   result = ExtractBlock(file, "metadata", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("metadata", block_lines,
@@ -65,7 +232,6 @@ ReadResult Table::ReadTable(const std::string fname) {
     metadata[k] = v;
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
@@ -73,7 +239,6 @@ ReadResult Table::ReadTable(const std::string fname) {
   // Read in the scalars
   result = ExtractBlock(file, "scalars", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("scalars", block_lines,
@@ -81,7 +246,6 @@ ReadResult Table::ReadTable(const std::string fname) {
     scalars[k] = std::stod(v);
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
@@ -89,7 +253,6 @@ ReadResult Table::ReadTable(const std::string fname) {
   // Read in the points
   result = ExtractBlock(file, "points", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   result = ParseBlock("points", block_lines,
@@ -97,7 +260,6 @@ ReadResult Table::ReadTable(const std::string fname) {
     point_info.push_back({k, std::stoi(v)});
   });
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   block_lines.clear();
@@ -106,7 +268,6 @@ ReadResult Table::ReadTable(const std::string fname) {
   // Read in the fields
   result = ExtractBlock(file, "fields", block_lines);
   if (result.error != ReadResult::SUCCESS) {
-    file.close();
     return result;
   }
   for (auto line : block_lines) {
@@ -114,10 +275,8 @@ ReadResult Table::ReadTable(const std::string fname) {
     field_names.push_back(line);
   }
 
-  size_t header_size = file.tellg();
-  file.close();
+  header_size = file.tellg();
 
-  // Allocate memory for the fields.
   npoints = 1;
   mem_size = 0;
   for (auto& p : point_info) {
@@ -125,9 +284,16 @@ ReadResult Table::ReadTable(const std::string fname) {
     mem_size += p.second;
   }
   mem_size += npoints*field_names.size();
-  data = new double[mem_size];
 
-  // Set the memory offsets for all the fields.
+  result.error = ReadResult::SUCCESS;
+  return result;
+}
+
+//----------------------------------------------------------------------------------------
+//! \fn void Table::SetFieldPointers()
+//! \brief Sets the memory offsets of all the points and fields in data.
+
+void Table::SetFieldPointers() {
   size_t offset = 0;
   for (auto &p : point_info) {
     fields[p.first] = &data[offset];
@@ -137,9 +303,15 @@ ReadResult Table::ReadTable(const std::string fname) {
     fields[s] = &data[offset];
     offset += npoints;
   }
+}
 
-  initialized = true;
+//----------------------------------------------------------------------------------------
+//! \fn ReadResult Table::ReadData()
+//! \brief Reads the binary section of the file (after the header) into data.
 
+ReadResult Table::ReadData(const std::string fname) {
+  ReadResult result;
+  std::ifstream file;
   // Now we need to load the table memory itself. We reopen the file as a binary.
   try {
     file.open(fname.c_str(), std::ifstream::in | std::ifstream::binary);
@@ -184,7 +356,7 @@ ReadResult Table::ReadTable(const std::string fname) {
   return result;
 }
 
-ReadResult Table::ExtractBlock(std::ifstream& file, const std::string name,
+ReadResult Table::ExtractBlock(std::istream& file, const std::string name,
                                std::vector<std::string>& lines) {
   ReadResult result;
   // Read the first block
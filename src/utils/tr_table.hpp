@@ -12,9 +12,16 @@
 #include <map>
 #include <vector>
 #include <fstream>
+#include <istream>
 #include <sstream>
 #include <utility>
 
+#include "config.hpp"
+
+#if MPI_PARALLEL_ENABLED
+#include <mpi.h>
+#endif
+
 namespace TableReader {
 
 struct ReadResult {
@@ -32,7 +39,10 @@ class Table {
   Table();
   ~Table();
 
-  ReadResult ReadTable(const std::string fname);
+  // With MPI, by default one rank per node reads the file into an MPI-3 shared memory
+  // window mapped by all ranks on the node.  ReadTable() is then collective over
+  // MPI_COMM_WORLD, and the data must be treated as read-only.
+  ReadResult ReadTable(const std::string fname, bool node_shared=true);
 
   inline const std::map<std::string, std::string> GetMetadata() {
     return metadata;
@@ -99,7 +109,14 @@ class Table {
     return result;
   }
 
-  ReadResult ExtractBlock(std::ifstream& file, const std::string name,
+  ReadResult ReadHeader(std::istream& file);
+  ReadResult ReadData(const std::string fname);
+  void SetFieldPointers();
+#if MPI_PARALLEL_ENABLED
+  ReadResult ReadTableShared(const std::string fname);
+#endif
+
+  ReadResult ExtractBlock(std::istream& file, const std::string name,
                           std::vector<std::string>& lines);
 
   bool SplitToken(const std::string& in, std::string& key, std::string& value);
@@ -115,9 +132,22 @@ class Table {
   size_t ndim;
   size_t npoints;
   size_t mem_size;
+  size_t header_size;
   bool initialized;
+#if MPI_PARALLEL_ENABLED
+  bool shared;       // data lives in node-shared window (not allocated with new)
+  MPI_Win win;
+#endif
 };
 
+#if MPI_PARALLEL_ENABLED
+// Allocates nbytes in an MPI-3 shared memory window owned by rank 0 of each node and
+// mapped by all ranks on the node, for data derived from a table.  Collective over
+// MPI_COMM_WORLD; leader is set on the rank that must fill the memory, after which all
+// ranks call MPI_Win_fence on win.  The window is freed in MPI_Finalize.
+void * AllocateNodeShared(size_t nbytes, bool& leader, MPI_Win& win);
+#endif
+
 } // namespace TableReader
 
 #endif // UTILS_TR_TABLE_HPP_
@@ -94,13 +94,15 @@ void CCE::InterpolateAndDecompose(MeshBlockPack *pmbp) {
   // Dynamically allocate memory for the 4D array flattened into 1D
   Real* data_real = new Real[count];
   Real* data_imag = new Real[count];
+  // ADM variables are read from u_adm or computed from the Z4c variables if released
+  auto adm = pmbp->padm->GetADMView();
   for(int nvar=0; nvar<10; nvar++) {
     for (int k = 0; k < nr; ++k) {
       // Interpolate here
       if (variable_to_dump[nvar].second) {
         grids[k]->InterpolateToSphere(variable_to_dump[nvar].first,pmbp->pz4c->u0);
       } else {
-        grids[k]->InterpolateToSphere(variable_to_dump[nvar].first,pmbp->padm->u_adm);
+        grids[k]->InterpolateToSphere(variable_to_dump[nvar].first,adm);
       }
       for (int l = 0; l < num_l_modes+1; ++l) {
         for (int m = -l; m < l+1 ; ++m) {
@@ -114,12 +114,25 @@ void CompactObjectTracker::InterpolateVelocity(MeshBlockPack *pmbp) {
       Real zy = S->Interpolate(pmhd->w0, IVY);
       Real zz = S->Interpolate(pmhd->w0, IVZ);
 
-      Real gxx = S->Interpolate(padm->u_adm, padm->I_ADM_GXX);
-      Real gxy = S->Interpolate(padm->u_adm, padm->I_ADM_GXY);
-      Real gxz = S->Interpolate(padm->u_adm, padm->I_ADM_GXZ);
-      Real gyy = S->Interpolate(padm->u_adm, padm->I_ADM_GYY);
-      Real gyz = S->Interpolate(padm->u_adm, padm->I_ADM_GYZ);
-      Real gzz = S->Interpolate(padm->u_adm, padm->I_ADM_GZZ);
+      Real gxx, gxy, gxz, gyy, gyz, gzz;
+      if (padm->is_allocated) {
+        gxx = S->Interpolate(padm->u_adm, padm->I_ADM_GXX);
+        gxy = S->Interpolate(padm->u_adm, padm->I_ADM_GXY);
+        gxz = S->Interpolate(padm->u_adm, padm->I_ADM_GXZ);
+        gyy = S->Interpolate(padm->u_adm, padm->I_ADM_GYY);
+        gyz = S->Interpolate(padm->u_adm, padm->I_ADM_GYZ);
+        gzz = S->Interpolate(padm->u_adm, padm->I_ADM_GZZ);
+      } else {
+        // u_adm released: g_ij = psi^4 gt_ij from the interpolated Z4c variables
+        Real psi4 = std::pow(S->Interpolate(pz4c->u0, pz4c->I_Z4C_CHI),
+                             4./pz4c->opt.chi_psi_power);
+        gxx = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GXX);
+        gxy = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GXY);
+        gxz = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GXZ);
+        gyy = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GYY);
+        gyz = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GYZ);
+        gzz = psi4*S->Interpolate(pz4c->u0, pz4c->I_Z4C_GZZ);
+      }
 
       Real z_x = gxx*zx + gxy*zy + gxz*zz;
       Real z_y = gxy*zx + gyy*zy + gyz*zz;
@@ -96,12 +96,14 @@ void HorizonDump::SetGridAndInterpolate(Real center[NDIM]) {
   // Dynamically allocate memory for the 4D array flattened into 1D
   Real* data_out = new Real[count];
 
+  // ADM variables are read from u_adm or computed from the Z4c variables if released
+  auto adm = pmbp->padm->GetADMView();
   for(int nvar=0; nvar<16; nvar++) {
     // Interpolate here
     if (variable_to_dump[nvar].second) {
       pcat_grid->InterpolateToGrid(variable_to_dump[nvar].first,pmbp->pz4c->u0);
     } else {
-      pcat_grid->InterpolateToGrid(variable_to_dump[nvar].first,pmbp->padm->u_adm);
+      pcat_grid->InterpolateToGrid(variable_to_dump[nvar].first,adm);
     }
     for (int nx = 0; nx < horizon_nx; nx ++)
     for (int ny = 0; ny < horizon_nx; ny ++)
@@ -154,6 +154,9 @@ Z4c::Z4c(MeshBlockPack *ppack, ParameterInput *pin) :
       pin->GetOrAddInteger("z4c", "extrap_order", 2))));
 
   diss = opt.diss*pow(2., -2.*indcs.ng)*(indcs.ng % 2 == 0 ? -1. : 1.);
+
+  con_every_cycle = pin->GetOrAddBoolean("z4c", "constraints_every_cycle", false);
+  con_needed = true;
   }
 
   // allocate memory for conserved variables on coarse mesh
@@ -20,6 +20,7 @@
 #include "tasklist/task_list.hpp"
 #include "bvals/bvals.hpp"
 #include "athena_tensor.hpp"
+#include "coordinates/adm.hpp"
 #include "geodesic-grid/geodesic_grid.hpp"
 #include "geodesic-grid/spherical_grid.hpp"
 
@@ -119,6 +120,9 @@ class Z4c {
   Z4c_vars z4c;
   Z4c_vars rhs;
 
+  // ADM variables computed pointwise from the Z4c variables (see ADM::GetADMView)
+  adm::ADM::ADM_view GetADMView();
+
   // aliases for the constraints
   struct Constraint_vars {
     AthenaTensor<Real, TensorSymm::NONE, 3, 0> C;         // Z constraint monitor
@@ -179,6 +183,10 @@ class Z4c {
   };
   Options opt;
   Real diss;              // Dissipation parameter
+  // ADM constraints are only evaluated in cycles in which an output uses them (the
+  // Driver sets con_needed), unless <z4c>/constraints_every_cycle = true
+  bool con_every_cycle;
+  bool con_needed;
 
   // Boundary communication buffers and functions for u
   MeshBoundaryValuesCC *pbval_u;
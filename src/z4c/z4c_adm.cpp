@@ -193,6 +193,27 @@ void Z4c::ADMToZ4c(MeshBlockPack *pmbp, ParameterInput *pin) {
 template void Z4c::ADMToZ4c<2>(MeshBlockPack *pmbp, ParameterInput *pin);
 template void Z4c::ADMToZ4c<3>(MeshBlockPack *pmbp, ParameterInput *pin);
 template void Z4c::ADMToZ4c<4>(MeshBlockPack *pmbp, ParameterInput *pin);
+//----------------------------------------------------------------------------------------
+//! \fn adm::ADM::ADM_view Z4c::GetADMView()
+//! \brief Returns accessors that compute the ADM variables from the current Z4c variables
+//! pointwise.  Must be called again after the Z4c arrays are reallocated (e.g. with AMR).
+
+adm::ADM::ADM_view Z4c::GetADMView() {
+  adm::ADM::ADM_view view;
+  view.alpha = z4c.alpha;
+  view.beta_u = z4c.beta_u;
+  view.psi4.stored = false;
+  view.psi4.psi4 = z4c.chi;
+  view.psi4.power = 4./opt.chi_psi_power;
+  view.g_dd.psi4 = view.psi4;
+  view.g_dd.g_dd = z4c.g_dd;
+  view.vK_dd.g_dd = view.g_dd;
+  view.vK_dd.vK_dd = z4c.vA_dd;
+  view.vK_dd.vKhat = z4c.vKhat;
+  view.vK_dd.vTheta = z4c.vTheta;
+  return view;
+}
+
 //----------------------------------------------------------------------------------------
 //! \fn void Z4c::Z4cToADM(MeshBlockPack *pmbp)
 //! \brief Compute ADM Psi4, g_ij, and K_ij from Z4c variables
@@ -211,25 +232,18 @@ void Z4c::Z4cToADM(MeshBlockPack *pmbp) {
 
   int nmb = pmbp->nmb_thispack;
 
-  auto &z4c = pmbp->pz4c->z4c;
   auto &adm = pmbp->padm->adm;
-  auto &opt = pmbp->pz4c->opt;
+  auto view = pmbp->pz4c->GetADMView();
   par_for("initialize z4c fields",DevExeSpace(),
   0,nmb-1,ksg,keg,jsg,jeg,isg,ieg,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
-    adm.psi4(m,k,j,i) = pow(z4c.chi(m,k,j,i), 4./opt.chi_psi_power);
+    adm.psi4(m,k,j,i) = view.psi4(m,k,j,i);
 
-    // g_ab
+    // g_ab and K_ab
     for(int a = 0; a < 3; ++a)
     for(int b = a; b < 3; ++b) {
-      adm.g_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.g_dd(m,a,b,k,j,i);
-    }
-
-    // K_ab
-    for(int a = 0; a < 3; ++a)
-    for(int b = a; b < 3; ++b) {
-      adm.vK_dd(m,a,b,k,j,i) = adm.psi4(m,k,j,i) * z4c.vA_dd(m,a,b,k,j,i) +
-        (1./3.) * (z4c.vKhat(m,k,j,i) + 2.*z4c.vTheta(m,k,j,i)) * adm.g_dd(m,a,b,k,j,i);
+      adm.g_dd(m,a,b,k,j,i) = view.g_dd(m,a,b,k,j,i);
+      adm.vK_dd(m,a,b,k,j,i) = view.vK_dd(m,a,b,k,j,i);
     }
   });
   return;
@@ -260,7 +274,7 @@ void Z4c::ADMConstraints(MeshBlockPack *pmbp) {
   int nmb = pmbp->nmb_thispack;
 
   auto &z4c = pmbp->pz4c->z4c;
-  auto &adm = pmbp->padm->adm;
+  auto adm = pmbp->padm->GetADMView();
   auto &u_con = pmbp->pz4c->u_con;
 
   // vacuum or with matter?
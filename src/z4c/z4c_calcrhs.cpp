@@ -37,13 +37,16 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
   auto &z4c = pmy_pack->pz4c->z4c;
   auto &rhs = pmy_pack->pz4c->rhs;
   auto &opt = pmy_pack->pz4c->opt;
+  auto &u0 = pmy_pack->pz4c->u0;
+  auto &u_rhs = pmy_pack->pz4c->u_rhs;
+  Real diss = pmy_pack->pz4c->diss;
 
   bool is_vacuum = (pmy_pack->ptmunu == nullptr) ? true : false;
   Tmunu::Tmunu_vars tmunu;
   if (!is_vacuum) tmunu = pmy_pack->ptmunu->tmunu;
 
   // ===================================================================================
-  // Main RHS calculation
+  // Main RHS calculation, including Kreiss-Oliger dissipation
   //
   par_for("z4c rhs loop",DevExeSpace(),0,nmb-1,ks,ke,js,je,is,ie,
   KOKKOS_LAMBDA(const int m, const int k, const int j, const int i) {
@@ -554,20 +557,16 @@ TaskStatus Z4c::CalcRHS(Driver *pdriver, int stage) {
           chi_guarded * (0.5 * z4c.alpha(m,k,j,i) * dchi_d(b) - dalpha_d(b)) * g_uu(a,b);
       }
     }
-  });
 
-  // ===================================================================================
-  // Add dissipation for stability
-  //
-  Real &diss = pmy_pack->pz4c->diss;
-  auto &u0 = pmy_pack->pz4c->u0;
-  auto &u_rhs = pmy_pack->pz4c->u_rhs;
-  par_for("K-O Dissipation",
-  DevExeSpace(),0,nmb-1,0,nz4c-1,ks,ke,js,je,is,ie,
-  KOKKOS_LAMBDA(const int m, const int n, const int k, const int j, const int i) {
-    Real idx[] = {1/size.d_view(m).dx1, 1/size.d_view(m).dx2, 1/size.d_view(m).dx3};
-    for(int a = 0; a < 3; ++a) {
-      u_rhs(m,n,k,j,i) += Diss<NGHOST>(a, idx, u0, m, n, k, j, i)*diss;
+    // -----------------------------------------------------------------------------------
+    // Add Kreiss-Oliger dissipation for stability.  Done in the same kernel as the RHS
+    // (after all rhs components at this point are set) to avoid a second pass over u0.
+    for(int n = 0; n < nz4c; ++n) {
+      Real kodiss = 0.0;
+      for(int a = 0; a < 3; ++a) {
+        kodiss += Diss<NGHOST>(a, idx, u0, m, n, k, j, i);
+      }
+      u_rhs(m,n,k,j,i) += diss*kodiss;
     }
   });
 
@@ -37,7 +37,7 @@ void Z4c::Z4cWeyl(MeshBlockPack *pmbp) {
   int &ks = indcs.ks; int &ke = indcs.ke;
   int nmb = pmbp->nmb_thispack;
 
-  auto &adm = pmbp->padm->adm;
+  auto adm = pmbp->padm->GetADMView();
   auto &weyl = pmbp->pz4c->weyl;
   auto &u_weyl = pmbp->pz4c->u_weyl;
   Kokkos::deep_copy(u_weyl, 0.);
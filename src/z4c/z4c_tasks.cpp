@@ -137,8 +137,6 @@ TaskStatus Z4c::ClearSend(Driver *pdrive, int stage) {
 //! \brief  copy u0 --> u1 in first stage
 
 TaskStatus Z4c::CopyU(Driver *pdrive, int stage) {
-  auto integrator = pdrive->integrator;
-
   auto &indcs = pmy_pack->pmesh->mb_indcs;
   int is = indcs.is, ie = indcs.ie;
   int js = indcs.js, je = indcs.je;
@@ -151,20 +149,15 @@ TaskStatus Z4c::CopyU(Driver *pdrive, int stage) {
   // hierarchical parallel loop that updates conserved variables to intermediate step
   // using weights and fractional time step appropriate to stages of time-integrator.
   // Important to use vector inner loop for good performance on cpus
-  if (integrator == "rk4") {
+  if (stage == 1) {
+    Kokkos::deep_copy(DevExeSpace(), u1, u0);
+  } else if (pdrive->delta[stage-1] != 0.0) {
+    // update u1 with u0 at later stages, only for integrators that need it (e.g. rk4)
     Real &delta = pdrive->delta[stage-1];
-    if (stage == 1) {
-      Kokkos::deep_copy(DevExeSpace(), u1, u0);
-    } else {
-      par_for("CopyCons", DevExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
-      KOKKOS_LAMBDA(int m, int n, int k, int j, int i){
-        u1(m,n,k,j,i) += delta*u0(m,n,k,j,i);
-      });
-    }
-  } else {
-    if (stage == 1) {
-      Kokkos::deep_copy(DevExeSpace(), u1, u0);
-    }
+    par_for("CopyCons", DevExeSpace(),0, nmb1, 0, nvar-1, ks, ke, js, je, is, ie,
+    KOKKOS_LAMBDA(int m, int n, int k, int j, int i){
+      u1(m,n,k,j,i) += delta*u0(m,n,k,j,i);
+    });
   }
   return TaskStatus::complete;
 }
@@ -203,6 +196,8 @@ TaskStatus Z4c::EnforceAlgConstr(Driver *pdrive, int stage) {
 //! \brief
 
 TaskStatus Z4c::ConvertZ4cToADM(Driver *pdrive, int stage) {
+  // nothing to do if u_adm has been released (see <z4c>/store_adm)
+  if (!(pmy_pack->padm->is_allocated)) return TaskStatus::complete;
   if (pmy_pack->pdyngr != nullptr || stage == pdrive->nexp_stages) {
     Z4cToADM(pmy_pack);
   }
@@ -222,11 +217,12 @@ TaskStatus Z4c::UpdateExcisionMasks(Driver *pdrive, int stage) {
 
 //----------------------------------------------------------------------------------------
 //! \fn  void Z4c::ADM_Constraints_
-//! \brief
+//! \brief Evaluates the ADM constraints at the last stage, but only in cycles in which
+//! they will be used by an output (see Driver::ScheduleZ4cConstraints)
 
 TaskStatus Z4c::ADMConstraints_(Driver *pdrive, int stage) {
   auto &indcs = pmy_pack->pmesh->mb_indcs;
-  if (stage == pdrive->nexp_stages) {
+  if (stage == pdrive->nexp_stages && (con_needed || con_every_cycle)) {
     switch (indcs.ng) {
       case 2: ADMConstraints<2>(pmy_pack);
               break;
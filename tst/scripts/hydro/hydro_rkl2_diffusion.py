@@ -0,0 +1,70 @@
+# Regression test based on viscous diffusion of a Gaussian velocity profile
+#
+# Runs the 1D viscous diffusion problem at three resolutions with explicit viscosity
+# and with RKL2 super-time-stepping (<time>/sts_integrator=rkl2), and checks the L1
+# errors (which are computed by the executable automatically and stored in the
+# temporary file hydro_diffusion-errs.dat).  With STS the hyperbolic timestep is many
+# times the diffusive limit, so this tests both the convergence of the RKL2 stages and
+# that their errors remain comparable to those of the explicit update.
+
+# Modules
+import logging
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_sts = ['none', 'rkl2']
+_res = [64, 128, 256]
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for sv in _sts:
+        for res in _res:
+            arguments = ['job/basename=hydro_diffusion',
+                         'time/tlim=1.0',
+                         'time/integrator=rk2',
+                         'time/sts_integrator=' + sv,
+                         'mesh/nx1=' + repr(res),
+                         'meshblock/nx1=' + repr(res),
+                         'hydro/reconstruct=plm',
+                         'output1/dt=-1.0',
+                         'output2/dt=-1.0']
+            athena.run('tests/viscosity.athinput', arguments)
+
+
+# Analyze outputs
+def analyze():
+    # NOTE: the transverse velocity is decoupled from the sound waves in the linear
+    # regime, so the operator-split STS update should converge at second order like the
+    # explicit one.  A weaker threshold is used for the convergence rate to allow for
+    # the lower order of the time integration at the coarsest resolution.
+    logger.debug('Analyzing test ' + __name__)
+    data = athena_read.error_dat('build/src/hydro_diffusion-errs.dat')
+    data = data.reshape([len(_sts), len(_res), data.shape[-1]])
+    analyze_status = True
+    for si, sv in enumerate(_sts):
+        for ri in range(1, len(_res)):
+            rms_errs = data[si, ri-1:ri+1, 4]
+            if rms_errs[1] / rms_errs[0] > 0.35:
+                logger.warning('{0} diffusion not converging at nx1={1}: '
+                               'ratio={2:g}'.format(sv, _res[ri],
+                                                    rms_errs[1] / rms_errs[0]))
+                analyze_status = False
+    # STS errors at highest resolution must be close to the explicit errors
+    err_explicit = data[0, -1, 4]
+    err_sts = data[1, -1, 4]
+    if err_sts > 2.0 * err_explicit:
+        logger.warning('rkl2 error {0:g} too large compared to explicit error '
+                       '{1:g}'.format(err_sts, err_explicit))
+        analyze_status = False
+    # STS must take fewer cycles than the explicit update
+    if data[1, -1, 3] >= data[0, -1, 3]:
+        logger.warning('rkl2 did not reduce number of cycles: {0:d} vs {1:d}'.format(
+            int(data[1, -1, 3]), int(data[0, -1, 3])))
+        analyze_status = False
+
+    return analyze_status
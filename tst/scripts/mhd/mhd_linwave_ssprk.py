@@ -0,0 +1,146 @@
+# Regression test based on Newtonian MHD linear wave convergence problem
+#
+# Runs a linear wave convergence test in 3D with the low-storage SSP Runge-Kutta
+# integrators ssprk4_3 and ssprk10_4, and checks L1 errors (which are computed by the
+# executable automatically and stored in the temporary file
+# mhd_lin_wave_ssprk-errs.dat).  We test L-/R- fast, L-/R-Alfven, L-/R- slow waves and
+# the entropy wave with high-order reconstruction, using the same thresholds as rk3 in
+# mhd_linwave.py.  ssprk10_4 also exercises the delta*u0 update of u1 and b1, and is
+# run at CFL number 1.5 (five times the default, within its SSP coefficient of 6), where
+# it must remain stable, converge at the same rate, and give errors comparable to those
+# at the default CFL number.
+
+# Modules
+import logging
+import scripts.utils.athena as athena
+import sys
+sys.path.insert(0, '../vis/python')
+import athena_read  # noqa
+athena_read.check_nan_flag = True
+logger = logging.getLogger('athena' + __name__[7:])  # set logger name
+_int = ['ssprk4_3', 'ssprk10_4']
+_recon = ['ppmx', 'wenoz']
+_flux = ['hlld']
+_wave = ['L-fast', 'R-fast', 'L-Alfven', 'R-Alfven',
+         'L-slow', 'R-slow', 'entropy']
+_flag = [0, 6, 1, 5, 2, 4, 3]
+_cfl = 1.5  # CFL number for ssprk10_4 runs at large timestep
+
+
+# Run AthenaK
+def run(**kwargs):
+    logger.debug('Runnning test ' + __name__)
+    for iv in _int:
+        for rv in _recon:
+            for fv in _flux:
+                for res in (16, 32):
+                    arguments = ['job/basename=mhd_lin_wave_ssprk',
+                                 'time/tlim=1.0',
+                                 'time/nlim=1000',
+                                 'time/integrator=' + iv,
+                                 'mesh/nghost=3',
+                                 'mesh/nx1=' + repr(res),
+                                 'mesh/nx2=' + repr(res/2),
+                                 'mesh/nx3=' + repr(res/2),
+                                 'meshblock/nx1=' + repr(res/4),
+                                 'meshblock/nx2=' + repr(res/4),
+                                 'meshblock/nx3=' + repr(res/4),
+                                 'mhd/reconstruct=' + rv,
+                                 'mhd/rsolver=' + fv,
+                                 'problem/amp=1.0e-6',
+                                 'output1/dt=-1.0',
+                                 'output2/dt=-1.0',
+                                 'output3/dt=-1.0',
+                                 'output4/dt=-1.0',
+                                 'output5/dt=-1.0']
+                    for wv, flag in zip(_wave, _flag):
+                        vflow = '1.0' if wv == 'entropy' else '0.0'
+                        args = arguments + ['problem/wave_flag=' + repr(flag),
+                                            'problem/vflow=' + vflow]
+                        athena.run('tests/linear_wave_mhd.athinput', args)
+    # ssprk10_4 at large CFL number
+    for rv in _recon:
+        for res in (16, 32):
+            arguments = ['job/basename=mhd_lin_wave_ssprk_cfl',
+                         'time/tlim=1.0',
+                         'time/nlim=1000',
+                         'time/integrator=ssprk10_4',
+                         'time/cfl_number=' + repr(_cfl),
+                         'mesh/nghost=3',
+                         'mesh/nx1=' + repr(res),
+                         'mesh/nx2=' + repr(res/2),
+                         'mesh/nx3=' + repr(res/2),
+                         'meshblock/nx1=' + repr(res/4),
+                         'meshblock/nx2=' + repr(res/4),
+                         'meshblock/nx3=' + repr(res/4),
+                         'mhd/reconstruct=' + rv,
+                         'mhd/rsolver=' + _flux[0],
+                         'problem/amp=1.0e-6',
+                         'output1/dt=-1.0',
+                         'output2/dt=-1.0',
+                         'output3/dt=-1.0',
+                         'output4/dt=-1.0',
+                         'output5/dt=-1.0']
+            for wv, flag in zip(_wave, _flag):
+                vflow = '1.0' if wv == 'entropy' else '0.0'
+                args = arguments + ['problem/wave_flag=' + repr(flag),
+                                    'problem/vflow=' + vflow]
+                athena.run('tests/linear_wave_mhd.athinput', args)
+
+
+# Analyze outputs
+def analyze():
+    logger.debug('Analyzing test ' + __name__)
+    data = athena_read.error_dat('build/src/mhd_lin_wave_ssprk-errs.dat')
+    data = data.reshape([len(_int), len(_recon), len(_flux), 2,
+                         len(_wave), data.shape[-1]])
+    analyze_status = True
+    error_threshold = [2.0e-8, 2.0e-8, 5.0e-8, 5.0e-8, 2.0e-7, 2.0e-7, 5.0e-9]
+    conv_threshold = [0.15, 0.15, 0.23, 0.23, 0.15, 0.15, 0.08]
+    for ii, iv in enumerate(_int):
+        for ri, rv in enumerate(_recon):
+            for fi, fv in enumerate(_flux):
+                for wi, wv in enumerate(_wave):
+                    l1_rms_n16 = (data[ii][ri][fi][0][wi][4])
+                    l1_rms_n32 = (data[ii][ri][fi][1][wi][4])
+                    if l1_rms_n32 > error_threshold[wi]:
+                        logger.warning("{0} wave error too large for {1}+"
+                                       "{2}+{3} configuration, "
+                                       "error: {4:g} threshold: {5:g}".
+                                       format(wv, iv, rv, fv,
+                                              l1_rms_n32,
+                                              error_threshold[wi]))
+                        analyze_status = False
+                    if l1_rms_n32/l1_rms_n16 > conv_threshold[wi]:
+                        logger.warning("{0} wave not converging for {1}+"
+                                       "{2}+{3} configuration, "
+                                       "conv: {4:g} threshold: {5:g}".
+                                       format(wv, iv, rv, fv,
+                                              l1_rms_n32/l1_rms_n16,
+                                              conv_threshold[wi]))
+                        analyze_status = False
+
+    # ssprk10_4 at large CFL number must converge, with errors at most twice those at
+    # the default CFL number (check_nan_flag catches unstable runs)
+    data_cfl = athena_read.error_dat('build/src/mhd_lin_wave_ssprk_cfl-errs.dat')
+    data_cfl = data_cfl.reshape([len(_recon), 2, len(_wave), data_cfl.shape[-1]])
+    ii = _int.index('ssprk10_4')
+    for ri, rv in enumerate(_recon):
+        for wi, wv in enumerate(_wave):
+            l1_rms_n16 = data_cfl[ri][0][wi][4]
+            l1_rms_n32 = data_cfl[ri][1][wi][4]
+            l1_rms_ref = data[ii][ri][0][1][wi][4]
+            if not l1_rms_n32 <= 2.0*l1_rms_ref:
+                logger.warning("{0} wave error too large for ssprk10_4+{1}+{2} "
+                               "at cfl_number={3:g}, error: {4:g} reference: {5:g}".
+                               format(wv, rv, _flux[0], _cfl, l1_rms_n32,
+                                      l1_rms_ref))
+                analyze_status = False
+            if not l1_rms_n32/l1_rms_n16 <= conv_threshold[wi]:
+                logger.warning("{0} wave not converging for ssprk10_4+{1}+{2} "
+                               "at cfl_number={3:g}, conv: {4:g} threshold: {5:g}".
+                               format(wv, rv, _flux[0], _cfl,
+                                      l1_rms_n32/l1_rms_n16, conv_threshold[wi]))
+                analyze_status = False
+
+    return analyze_status
@@ -0,0 +1,53 @@
+"""
+Regression test for bulk migration of MeshBlocks during AMR load balancing with MPI.
+Runs the 2D MHD linear wave with AMR on 4 ranks, once with the default one message per
+migrating MeshBlock, and once with <mesh_refinement>/bulk_migration=true.  Only the
+packing and messaging of the migrated data differ, so the errors must agree.
+"""
+
+# Modules
+import pytest
+import numpy as np
+import test_suite.testutils as testutils
+import athena_read
+
+input_file = "inputs/lwave_mhd.athinput"
+
+
+# Important amp=1.0e-3 so that it is large enough to trigger AMR
+def arguments(name, bulk):
+    """Assemble arguments for run command"""
+    return [
+        f"job/basename={name}",
+        "time/tlim=1.0",
+        "time/integrator=rk2",
+        "mesh/nghost=2",
+        "mesh/nx1=64",
+        "mesh/nx2=32",
+        "mesh/nx3=1",
+        "meshblock/nx1=4",
+        "meshblock/nx2=4",
+        "meshblock/nx3=1",
+        "time/cfl_number=0.4",
+        "mhd/reconstruct=plm",
+        "mhd/rsolver=hlld",
+        "problem/amp=1.0e-3",
+        "problem/wave_flag=0",
+        f"mesh_refinement/bulk_migration={'true' if bulk else 'false'}",
+    ]
+
+
+def test_run():
+    """Compare errors of run with bulk migration to run with default migration."""
+    try:
+        for name, bulk in [("lwave2d_amr_permb", False), ("lwave2d_amr_bulk", True)]:
+            results = testutils.mpi_run(input_file, arguments(name, bulk), threads=4)
+            assert results, f"Run failed with bulk_migration={bulk}."
+        data = athena_read.error_dat("lwave2d_amr_permb-errs.dat")
+        data_bulk = athena_read.error_dat("lwave2d_amr_bulk-errs.dat")
+        maxdiff = np.abs(data[0] - data_bulk[0]).max()
+        if maxdiff > 1.0e-14:
+            pytest.fail(f"Errors differ with bulk migration, max difference: "
+                        f"{maxdiff:g}")
+    finally:
+        testutils.cleanup()
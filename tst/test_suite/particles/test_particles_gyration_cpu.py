@@ -0,0 +1,65 @@
+"""
+Gyration test for the Boris particle pusher.
+Charged particles with u = gamma*v of magnitude u_perp perpendicular to a uniform
+magnetic field b0 (with the fluid at rest, so E = 0) move on circles of radius
+r = u_perp/(q_over_m*b0) with period T = 2*pi*gamma/(q_over_m*b0).  Checks that after
+half a period every particle is a diameter 2r away from its initial position, and that
+after a full period it has returned to it.
+"""
+
+# Modules
+import glob
+import shutil
+import numpy as np
+import pytest
+import test_suite.testutils as testutils
+
+input_file = "inputs/part_gyration.athinput"
+b0 = 10.0
+u_perp = 1.0
+q_over_m = 1.0
+
+
+def displacement(pos, pos0):
+    """Displacement between positions, using nearest periodic image in unit box"""
+    d = pos - pos0
+    return d - np.round(d)
+
+
+def test_run():
+    """Run one gyration period, and compare positions after half and full period."""
+    gamma = np.sqrt(1.0 + u_perp**2)
+    radius = u_perp/(q_over_m*b0)
+    period = 2.0*np.pi*gamma/(q_over_m*b0)
+    arguments = [
+        "job/basename=gyration",
+        "time/tlim=" + repr(period),
+        "output1/dt=" + repr(0.5*period),
+        "problem/b0=" + repr(b0),
+        "problem/u_perp=" + repr(u_perp),
+        "particles/q_over_m=" + repr(q_over_m),
+    ]
+    try:
+        results = testutils.run(input_file, arguments)
+        assert results, "Particle gyration test run failed."
+        files = sorted(glob.glob("pvtk/gyration.*.part.vtk"))
+        tag0, pos0 = testutils.read_particle_vtk(files[0])
+        tag1, pos1 = testutils.read_particle_vtk(files[1])
+        tag2, pos2 = testutils.read_particle_vtk(files[-1])
+        if tag0.size == 0 or not (np.array_equal(tag0, tag1) and
+                                  np.array_equal(tag0, tag2)):
+            pytest.fail("Particles lost during gyration test")
+
+        tol = 0.01*radius
+        diameter = np.sqrt((displacement(pos1, pos0)**2).sum(axis=1))
+        maxerr = np.abs(diameter - 2.0*radius).max()
+        if maxerr > tol:
+            pytest.fail(f"Gyration radius error too large after half period, error: "
+                        f"{maxerr:g} threshold: {tol:g}")
+        maxerr = np.sqrt((displacement(pos2, pos0)**2).sum(axis=1)).max()
+        if maxerr > tol:
+            pytest.fail(f"Particles not back at initial position after one period, "
+                        f"error: {maxerr:g} threshold: {tol:g}")
+    finally:
+        shutil.rmtree("pvtk", ignore_errors=True)
+        testutils.cleanup()
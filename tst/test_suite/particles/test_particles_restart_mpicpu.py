@@ -0,0 +1,47 @@
+"""
+Restart test for particles.
+Runs the random particle drift problem on 2 ranks to the final time, and again from
+the restart file written halfway through on 4 ranks.  Particles are redistributed to
+the new ranks on restart, so the final positions of all particles (matched by tag)
+must agree between the continuous and restarted runs.
+"""
+
+# Modules
+import glob
+import shutil
+import pytest
+import numpy as np
+import test_suite.testutils as testutils
+
+input_file = "inputs/part_random.athinput"
+
+
+def read_particles(basename):
+    """Returns tags and positions of particles in last pvtk file, sorted by tag"""
+    filename = sorted(glob.glob("pvtk/" + basename + ".*.part.vtk"))[-1]
+    return testutils.read_particle_vtk(filename)
+
+
+def test_run():
+    """Compare continuous run with run restarted on a different number of ranks."""
+    try:
+        results = testutils.mpi_run(input_file, ["job/basename=prst"], threads=2)
+        assert results, "Particle run on 2 ranks failed."
+        command = ["mpirun", "-np", "4", "./athena", "-r", "rst/prst.00001.rst",
+                   "job/basename=prst_restart"]
+        results = testutils.run_command(command)
+        assert results, "Particle restart on 4 ranks failed."
+
+        tag, pos = read_particles("prst")
+        tag_restart, pos_restart = read_particles("prst_restart")
+        if tag.size == 0 or not np.array_equal(tag, tag_restart):
+            pytest.fail(f"Particles lost on restart: {tag.size} particles in "
+                        f"continuous run, {tag_restart.size} after restart")
+        maxdiff = np.abs(pos - pos_restart).max()
+        if maxdiff > 1.0e-6:
+            pytest.fail(f"Particle positions differ after restart, max difference: "
+                        f"{maxdiff:g}")
+    finally:
+        shutil.rmtree("pvtk", ignore_errors=True)
+        shutil.rmtree("rst", ignore_errors=True)
+        testutils.cleanup()
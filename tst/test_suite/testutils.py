@@ -13,6 +13,7 @@ import time
 import pytest
 import logging
 import sys
+import numpy as np
 
 sys.path.insert(0, "../vis/python")
 import athena_read  # noqa: E402
@@ -198,6 +199,28 @@ def clean_make(threads: int = os.cpu_count(), **kwargs) -> None:
     run_command(["ln", "-s", "../../inputs", "inputs"])
 
 
+def read_particle_vtk(filename):
+    """
+    Reads particle positions from a (legacy, binary) particle vtk file.
+
+    Args:
+        filename: The path to the .part.vtk file.
+
+    Returns:
+        Particle tags and (x,y,z) positions, dimensioned [npart,3], sorted by tag.
+    """
+    with open(filename, "rb") as f:
+        raw = f.read()
+    start = raw.index(b"POINTS ")
+    end = raw.index(b"\n", start)
+    npart = int(raw[start:end].split()[1])
+    pos = np.frombuffer(raw, dtype=">f4", count=3 * npart, offset=end + 1)
+    key = b"SCALARS ptag float\nLOOKUP_TABLE default\n"
+    tag = np.frombuffer(raw, dtype=">f4", count=npart, offset=raw.index(key) + len(key))
+    order = np.argsort(tag)
+    return tag[order], pos.reshape(npart, 3)[order]
+
+
 def read_dictionary_from_file(file_path):
     """
     Reads a dictionary from a file where each line is in the format "key: value".